@@ -0,0 +1,157 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "VMCCurveProgram.h"
+#include "VMCLiveLinkRemapper.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VMCCurveTest
+{
+    // The MetaHuman normalizer as the remapper worker ran it before curve rules existed
+    static void LegacyNormalize(const TArray<FName>& Names, TArray<float>& Values, float JoyToSmileStrength, float BlinkMirrorStrength)
+    {
+        auto FindIdx = [&](FName Name)->int32 { return Names.IndexOfByKey(Name); };
+        auto Get = [&](FName Name, float& Out)->bool {
+            const int32 I = FindIdx(Name);
+            if (I != INDEX_NONE && Values.IsValidIndex(I)) { Out = Values[I]; return true; }
+            return false;
+            };
+        auto Set = [&](FName Name, float Val)->void {
+            const int32 I = FindIdx(Name);
+            if (I != INDEX_NONE && Values.IsValidIndex(I)) { Values[I] = Val; }
+            };
+
+        float BlinkL = 0.f, BlinkR = 0.f;
+        const bool HasL = Get("eyeBlinkLeft", BlinkL);
+        const bool HasR = Get("eyeBlinkRight", BlinkR);
+        if (HasL && !HasR) Set("eyeBlinkRight", FMath::Clamp(BlinkL * BlinkMirrorStrength, 0.f, 1.f));
+        if (HasR && !HasL) Set("eyeBlinkLeft", FMath::Clamp(BlinkR * BlinkMirrorStrength, 0.f, 1.f));
+
+        float Joy = 0.f;
+        if (Get("mouthSmileLeft", Joy))
+        {
+            const float V = FMath::Clamp(Joy * JoyToSmileStrength, 0.f, 1.f);
+            Set("mouthSmileLeft", V);
+            Set("mouthSmileRight", V);
+        }
+
+        float Funnel = 0.f;
+        if (Get("mouthFunnel", Funnel))
+        {
+            Set("mouthPucker", FMath::Clamp(Funnel * 0.5f, 0.f, 1.f));
+        }
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCCurveProgramNormalizerTest, "VMCLiveLink.CurveProgram.NormalizerEquivalence",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCCurveProgramNormalizerTest::RunTest(const FString& Parameters)
+{
+    using namespace VMCCurveTest;
+
+    const FName Pool[] = { "jawOpen", "mouthPucker", "eyeBlinkRight", "mouthSmileLeft", "mouthFunnel", "eyeBlinkLeft", "mouthSmileRight" };
+    constexpr int32 NumPool = UE_ARRAY_COUNT(Pool);
+    const float Strengths[][2] = { { 1.f, 1.f }, { 0.7f, 0.5f }, { 0.f, 0.25f } };
+
+    FRandomStream Random(0x564D43);
+    int32 Mismatches = 0;
+
+    // Every subset of the pool (in two orders), so rules meet missing inputs and outputs
+    for (int32 Mask = 0; Mask < (1 << NumPool); ++Mask)
+    {
+        for (int32 Reversed = 0; Reversed < 2; ++Reversed)
+        {
+            TArray<FName> Names;
+            for (int32 i = 0; i < NumPool; ++i)
+            {
+                const int32 k = Reversed ? NumPool - 1 - i : i;
+                if (Mask & (1 << k)) Names.Add(Pool[k]);
+            }
+
+            for (const auto& S : Strengths)
+            {
+                TArray<FVMCCurveRule> Rules;
+                UVMCLiveLinkRemapper::AppendNormalizerRules(S[0], S[1], Rules);
+
+                TArray<FName> ProgramNames = Names;
+                FVMCCurveProgram::AddMirrorOutputs(Rules, ProgramNames);
+                if (ProgramNames != Names)
+                {
+                    AddError(TEXT("The built-in normalizer must not add curves to the subject"));
+                    return false;
+                }
+                const TSharedPtr<FVMCCurveProgram, ESPMode::ThreadSafe> Program = FVMCCurveProgram::Compile(Rules, ProgramNames, Names.Num());
+
+                for (int32 Frame = 0; Frame < 4; ++Frame)
+                {
+                    TArray<float> Legacy;
+                    for (int32 i = 0; i < Names.Num(); ++i)
+                    {
+                        Legacy.Add(Random.FRandRange(-0.5f, 1.5f));   // outside 0..1 too: clamps matter
+                    }
+                    TArray<float> Compiled = Legacy;
+
+                    LegacyNormalize(Names, Legacy, S[0], S[1]);
+                    Program->Execute(Compiled);
+
+                    for (int32 i = 0; i < Names.Num(); ++i)
+                    {
+                        if (!FMath::IsNearlyEqual(Legacy[i], Compiled[i], 1e-6f) && ++Mismatches <= 5)
+                        {
+                            AddError(FString::Printf(TEXT("Mask 0x%02x, %s: legacy %f, compiled %f"),
+                                Mask, *Names[i].ToString(), Legacy[i], Compiled[i]));
+                        }
+                    }
+                }
+            }
+        }
+    }
+    TestEqual(TEXT("Mismatching values"), Mismatches, 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCCurveProgramMirrorTest, "VMCLiveLink.CurveProgram.MirrorOptIn",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCCurveProgramMirrorTest::RunTest(const FString& Parameters)
+{
+    FVMCCurveRule Rule;
+    Rule.Op = EVMCCurveOp::Mirror;
+    Rule.Inputs.Add("eyeBlinkLeft");
+    Rule.Output = "eyeBlinkRight";
+    Rule.Scale = 0.5f;
+    Rule.bAddMissingOutput = true;
+    const TArray<FVMCCurveRule> Rules = { Rule };
+
+    // Single-sided sender: the output is added after the sent names and filled every frame
+    TArray<FName> Names = { "jawOpen", "eyeBlinkLeft" };
+    FVMCCurveProgram::AddMirrorOutputs(Rules, Names);
+    if (!TestEqual(TEXT("Mirror output added"), Names.Num(), 3))
+    {
+        return false;
+    }
+    TestEqual(TEXT("Added last"), Names[2], FName("eyeBlinkRight"));
+
+    TArray<float> Values = { 0.3f, 0.8f, 0.f };
+    FVMCCurveProgram::Compile(Rules, Names, /*NumSentNames=*/2)->Execute(Values);
+    TestEqual(TEXT("Mirrored value"), Values[2], 0.4f);
+
+    // A sender that provides the output keeps its own value
+    TArray<FName> Both = { "eyeBlinkLeft", "eyeBlinkRight" };
+    FVMCCurveProgram::AddMirrorOutputs(Rules, Both);
+    TestEqual(TEXT("Nothing added"), Both.Num(), 2);
+    TArray<float> Sent = { 0.8f, 0.1f };
+    FVMCCurveProgram::Compile(Rules, Both, Both.Num())->Execute(Sent);
+    TestEqual(TEXT("Sent value untouched"), Sent[1], 0.1f);
+
+    // Without the opt-in the subject's names are left alone
+    Rule.bAddMissingOutput = false;
+    TArray<FName> Unchanged = { "eyeBlinkLeft" };
+    FVMCCurveProgram::AddMirrorOutputs({ Rule }, Unchanged);
+    TestEqual(TEXT("No opt-in, nothing added"), Unchanged.Num(), 1);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "Misc/AutomationTest.h"
+#include "VMCJitterBuffer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VMCJitterTest
+{
+    // Commits one frame; SenderSeconds < 0 = arrival-clock scheduling
+    static bool Commit(FVMCJitterBuffer& Buffer, uint64 Sequence, double Arrival, double SenderWorld = -1.0)
+    {
+        FVMCFrameSnapshot* Frame = Buffer.BeginWrite();
+        if (!Frame)
+        {
+            return false;
+        }
+        Frame->Sequence = Sequence;
+        Frame->CommitSeconds = Arrival;
+        Frame->SenderSeconds = SenderWorld >= 0.0 ? SenderWorld : -1.0;
+        Frame->WorldSeconds = SenderWorld >= 0.0 ? SenderWorld : Arrival;
+        Buffer.Publish();
+        return true;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCJitterBufferOrderTest, "VMCLiveLink.JitterBuffer.Ordering",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCJitterBufferOrderTest::RunTest(const FString& Parameters)
+{
+    using namespace VMCJitterTest;
+
+    TArray<uint64> Played;
+    TUniquePtr<FVMCJitterBuffer> Buffer = MakeUnique<FVMCJitterBuffer>(
+        [&Played](const FVMCFrameSnapshot& Frame) { Played.Add(Frame.Sequence); },
+        /*TargetMs=*/10.f, /*MaxMs=*/50.f, /*bAdaptive=*/false);
+
+    // Sender-timed frames at an uneven cadence
+    const double Base = 1000.0;
+    const double World[] = { 0.000, 0.016, 0.035, 0.050, 0.066, 0.090, 0.100, 0.116 };
+    constexpr int32 NumFrames = UE_ARRAY_COUNT(World);
+    for (int32 i = 0; i < NumFrames; ++i)
+    {
+        TestTrue(TEXT("Commit"), Commit(*Buffer, i, Base + World[i], Base + World[i]));
+    }
+
+    TestEqual(TEXT("Nothing is due before the playout delay"), Buffer->PlayDue(Base), Base + 0.010);
+    TestEqual(TEXT("Nothing played early"), Played.Num(), 0);
+
+    // Step the clock to each due time: every frame plays once, in commit order
+    double Now = Base + 0.010;
+    for (int32 Guard = 0; Guard < 64 && Now != MAX_dbl; ++Guard)
+    {
+        Now = Buffer->PlayDue(Now);
+    }
+    TestEqual(TEXT("All frames played"), Played.Num(), NumFrames);
+    for (int32 i = 0; i < Played.Num(); ++i)
+    {
+        TestEqual(TEXT("Playout order"), Played[i], (uint64)i);
+    }
+    TestEqual(TEXT("None skipped"), Buffer->GetStats().Skipped.load(), (uint64)0);
+    TestEqual(TEXT("Pushed"), Buffer->GetStats().Pushed.load(), (uint64)NumFrames);
+
+    // A timetag running backwards is never scheduled ahead of the frame committed before it
+    Played.Reset();
+    const double Back = Base + 0.5;
+    Commit(*Buffer, 50, Back, Back);
+    Commit(*Buffer, 51, Back + 0.001, Back - 0.020);
+    TestEqual(TEXT("Earlier timetag waits for the previous frame"), Buffer->PlayDue(Back + 0.009), Back + 0.010);
+    TestEqual(TEXT("Nothing played before the previous frame is due"), Played.Num(), 0);
+    TestEqual(TEXT("Drained"), Buffer->PlayDue(Back + 0.010), MAX_dbl);
+    if (TestEqual(TEXT("Both due together: newest plays"), Played.Num(), 1))
+    {
+        TestEqual(TEXT("Newest"), Played[0], (uint64)51);
+    }
+    TestEqual(TEXT("Superseded frame skipped"), Buffer->GetStats().Skipped.load(), (uint64)1);
+
+    // A stall: several frames due at once collapse to the newest
+    Played.Reset();
+    const double Later = Base + 1.0;
+    for (int32 i = 0; i < 4; ++i)
+    {
+        Commit(*Buffer, 100 + i, Later + i * 0.016, Later + i * 0.016);
+    }
+    TestEqual(TEXT("Drained"), Buffer->PlayDue(Later + 10.0), MAX_dbl);
+    if (TestEqual(TEXT("One frame after a stall"), Played.Num(), 1))
+    {
+        TestEqual(TEXT("The newest one"), Played[0], (uint64)103);
+    }
+    TestEqual(TEXT("Skipped"), Buffer->GetStats().Skipped.load(), (uint64)4);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCJitterBufferOverflowTest, "VMCLiveLink.JitterBuffer.Overflow",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCJitterBufferOverflowTest::RunTest(const FString& Parameters)
+{
+    using namespace VMCJitterTest;
+
+    TArray<uint64> Played;
+    TUniquePtr<FVMCJitterBuffer> Buffer = MakeUnique<FVMCJitterBuffer>(
+        [&Played](const FVMCFrameSnapshot& Frame) { Played.Add(Frame.Sequence); },
+        /*TargetMs=*/0.f, /*MaxMs=*/50.f, /*bAdaptive=*/false);
+
+    // Fill the ring without playing (arrival-clock frames at 60 Hz)
+    const double Base = 50.0;
+    for (int32 i = 0; i < FVMCJitterBuffer::Capacity; ++i)
+    {
+        TestTrue(TEXT("Ring accepts up to its capacity"), Commit(*Buffer, i, Base + i / 60.0));
+    }
+    TestFalse(TEXT("Full ring refuses the next frame"), Commit(*Buffer, 999, Base + 1.0));
+    TestEqual(TEXT("Overflow counted"), Buffer->GetStats().Overflow.load(), (uint64)1);
+
+    // Draining frees the ring; the refused frame was dropped, not queued
+    TestEqual(TEXT("Drained"), Buffer->PlayDue(Base + 10.0), MAX_dbl);
+    if (TestEqual(TEXT("Newest due frame played"), Played.Num(), 1))
+    {
+        TestEqual(TEXT("Newest accepted frame"), Played[0], (uint64)(FVMCJitterBuffer::Capacity - 1));
+    }
+    TestEqual(TEXT("Older frames skipped"), Buffer->GetStats().Skipped.load(), (uint64)(FVMCJitterBuffer::Capacity - 1));
+    TestTrue(TEXT("Accepts frames again"), Commit(*Buffer, 1000, Base + 11.0));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "Misc/AutomationTest.h"
+#include "VMCNameTable.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCNameTableCaseTest, "VMCLiveLink.NameTable.CaseFolding",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCNameTableCaseTest::RunTest(const FString& Parameters)
+{
+    FVMCNameTable Table;
+    bool bAdded = false;
+
+    const int32 Hips = Table.FindOrAdd(UTF8TEXTVIEW("Hips"), bAdded);
+    TestTrue(TEXT("First sight adds"), bAdded);
+
+    const int32 Lower = Table.FindOrAdd(UTF8TEXTVIEW("hips"), bAdded);
+    TestFalse(TEXT("Different case does not add"), bAdded);
+    TestEqual(TEXT("Different case shares the slot"), Lower, Hips);
+    TestEqual(TEXT("Find ignores case"), Table.Find(UTF8TEXTVIEW("HIPS")), Hips);
+    TestTrue(TEXT("First spelling is kept"), Table.GetName(Hips).ToString().Equals(TEXT("Hips"), ESearchCase::CaseSensitive));
+
+    const int32 Other = Table.FindOrAdd(UTF8TEXTVIEW("Hips2"), bAdded);
+    TestTrue(TEXT("Longer name adds"), bAdded);
+    TestNotEqual(TEXT("Longer name gets its own slot"), Other, Hips);
+    TestEqual(TEXT("Unknown name"), Table.Find(UTF8TEXTVIEW("Spine")), (int32)INDEX_NONE);
+
+    // Only ASCII letters fold: '[' (0x5B) and '{' (0x7B) differ by the case bit but are distinct
+    const int32 Bracket = Table.FindOrAdd(UTF8TEXTVIEW("a["), bAdded);
+    const int32 Brace = Table.FindOrAdd(UTF8TEXTVIEW("a{"), bAdded);
+    TestTrue(TEXT("Non-letters do not fold"), bAdded && Bracket != Brace);
+
+    TestEqual(TEXT("Num"), Table.Num(), 4);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCNameTableGrowthTest, "VMCLiveLink.NameTable.Growth",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCNameTableGrowthTest::RunTest(const FString& Parameters)
+{
+    // Well past the initial bucket count: several rehashes
+    constexpr int32 NumNames = 1000;
+
+    FVMCNameTable Table;
+    TArray<FString> Names;
+    for (int32 i = 0; i < NumNames; ++i)
+    {
+        Names.Add(FString::Printf(TEXT("Bone_%d"), i));
+        const FTCHARToUTF8 Utf8(*Names.Last());
+        bool bAdded = false;
+        const int32 Slot = Table.FindOrAdd(FUtf8StringView((const UTF8CHAR*)Utf8.Get(), Utf8.Length()), bAdded);
+        TestTrue(TEXT("New name adds"), bAdded);
+        TestEqual(TEXT("Slots are dense and in insertion order"), Slot, i);
+    }
+    TestEqual(TEXT("Num"), Table.Num(), NumNames);
+
+    for (int32 i = 0; i < NumNames; ++i)
+    {
+        const FTCHARToUTF8 Utf8(*Names[i].ToUpper());
+        if (Table.Find(FUtf8StringView((const UTF8CHAR*)Utf8.Get(), Utf8.Length())) != i)
+        {
+            AddError(FString::Printf(TEXT("'%s' lost its slot after rehashing"), *Names[i]));
+            break;
+        }
+        if (Table.GetName(i) != FName(*Names[i]))
+        {
+            AddError(FString::Printf(TEXT("Slot %d has the wrong FName"), i));
+            break;
+        }
+    }
+
+    Table.Reset();
+    TestEqual(TEXT("Reset empties"), Table.Num(), 0);
+    TestEqual(TEXT("Reset forgets names"), Table.Find(UTF8TEXTVIEW("Bone_1")), (int32)INDEX_NONE);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,241 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "Misc/AutomationTest.h"
+#include "VMCOscDecoder.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VMCOscTest
+{
+    // Big-endian OSC writer for building test datagrams
+    struct FWriter
+    {
+        TArray<uint8> Bytes;
+
+        FWriter& U32(uint32 V)
+        {
+            Bytes.Add(uint8(V >> 24)); Bytes.Add(uint8(V >> 16)); Bytes.Add(uint8(V >> 8)); Bytes.Add(uint8(V));
+            return *this;
+        }
+        FWriter& Float(float F)
+        {
+            uint32 U;
+            FMemory::Memcpy(&U, &F, sizeof(U));
+            return U32(U);
+        }
+        FWriter& String(const ANSICHAR* S)
+        {
+            const int32 Len = FCStringAnsi::Strlen(S);
+            Bytes.Append((const uint8*)S, Len);
+            do { Bytes.Add(0); } while (Bytes.Num() & 3);
+            return *this;
+        }
+        FWriter& Raw(const TArray<uint8>& Other)
+        {
+            Bytes.Append(Other);
+            return *this;
+        }
+        FWriter& Element(const TArray<uint8>& Element)
+        {
+            return U32((uint32)Element.Num()).Raw(Element);
+        }
+    };
+
+    static TArray<uint8> Message(const ANSICHAR* Address, float Value)
+    {
+        FWriter W;
+        W.String(Address).String(",f").Float(Value);
+        return W.Bytes;
+    }
+
+    static TArray<uint8> Bundle(uint64 TimeTag, const TArray<TArray<uint8>>& Elements)
+    {
+        FWriter W;
+        W.String("#bundle").U32(uint32(TimeTag >> 32)).U32(uint32(TimeTag));
+        for (const TArray<uint8>& E : Elements)
+        {
+            W.Element(E);
+        }
+        return W.Bytes;
+    }
+
+    struct FDecoded
+    {
+        FString Address;
+        uint64 TimeTag = 0;
+        bool bInBundle = false;
+        int32 NumArgs = 0;
+        float First = 0.f;
+    };
+
+    static bool Decode(const TArray<uint8>& Bytes, TArray<FDecoded>& Out, TArray<uint64>* OutBundleEnds = nullptr)
+    {
+        Out.Reset();
+        auto OnMessage = [&Out](const FVMCOscMessage& M)
+        {
+            FDecoded& D = Out.AddDefaulted_GetRef();
+            D.Address = FString(M.Address);
+            D.TimeTag = M.TimeTag;
+            D.bInBundle = M.bInBundle;
+            D.NumArgs = M.NumArgs;
+            D.First = M.NumArgs > 0 ? M.Args[0].AsFloat() : 0.f;
+        };
+        auto OnBundleEnd = [OutBundleEnds](uint64 TimeTag)
+        {
+            if (OutBundleEnds) OutBundleEnds->Add(TimeTag);
+        };
+        return FVMCOscDecoder::DecodePacket(Bytes.GetData(), Bytes.Num(), OnMessage, OnBundleEnd);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCOscDecoderMessageTest, "VMCLiveLink.OscDecoder.Message",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCOscDecoderMessageTest::RunTest(const FString& Parameters)
+{
+    using namespace VMCOscTest;
+
+    FWriter W;
+    W.String("/VMC/Ext/Bone/Pos").String(",sfffffff").String("Hips");
+    for (int32 i = 0; i < 7; ++i)
+    {
+        W.Float(float(i) * 0.5f);
+    }
+
+    int32 Calls = 0;
+    const bool bOk = FVMCOscDecoder::DecodePacket(W.Bytes.GetData(), W.Bytes.Num(), [&](const FVMCOscMessage& M)
+    {
+        ++Calls;
+        TestEqual(TEXT("Address"), FString(M.Address), FString(TEXT("/VMC/Ext/Bone/Pos")));
+        TestEqual(TEXT("NumArgs"), M.NumArgs, 8);
+        TestEqual(TEXT("String arg"), FString(M.Args[0].S), FString(TEXT("Hips")));
+        TestEqual(TEXT("Last float"), M.Args[7].AsFloat(), 3.f);
+        TestFalse(TEXT("Not in a bundle"), M.bInBundle);
+    });
+    TestTrue(TEXT("Decodes"), bOk);
+    TestEqual(TEXT("One message"), Calls, 1);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCOscDecoderNestedBundleTest, "VMCLiveLink.OscDecoder.NestedBundles",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCOscDecoderNestedBundleTest::RunTest(const FString& Parameters)
+{
+    using namespace VMCOscTest;
+
+    const uint64 Outer = (uint64(100) << 32) | 1;
+    const uint64 Inner = (uint64(200) << 32) | 2;
+    const TArray<uint8> Packet = Bundle(Outer, {
+        Message("/a", 1.f),
+        Bundle(Inner, { Message("/b", 2.f) }),
+        Message("/c", 3.f) });
+
+    TArray<FDecoded> Msgs;
+    TArray<uint64> Ends;
+    TestTrue(TEXT("Decodes"), Decode(Packet, Msgs, &Ends));
+    if (!TestEqual(TEXT("Flattened message count"), Msgs.Num(), 3))
+    {
+        return false;
+    }
+    TestEqual(TEXT("Order 0"), Msgs[0].Address, FString(TEXT("/a")));
+    TestEqual(TEXT("Order 1"), Msgs[1].Address, FString(TEXT("/b")));
+    TestEqual(TEXT("Order 2"), Msgs[2].Address, FString(TEXT("/c")));
+    TestEqual(TEXT("Outer timetag"), Msgs[0].TimeTag, Outer);
+    TestEqual(TEXT("Inner timetag"), Msgs[1].TimeTag, Inner);
+    TestEqual(TEXT("Outer timetag after inner bundle"), Msgs[2].TimeTag, Outer);
+    TestTrue(TEXT("In bundle"), Msgs[0].bInBundle && Msgs[1].bInBundle && Msgs[2].bInBundle);
+    TestEqual(TEXT("Values"), Msgs[1].First, 2.f);
+    if (TestEqual(TEXT("One bundle end"), Ends.Num(), 1))
+    {
+        TestEqual(TEXT("Bundle end carries the top-level timetag"), Ends[0], Outer);
+    }
+
+    // Nesting up to the depth limit decodes; one level deeper is rejected
+    auto Nest = [](int32 Levels)
+    {
+        TArray<uint8> P = Message("/deep", 1.f);
+        for (int32 i = 0; i < Levels; ++i)
+        {
+            P = Bundle(1, { P });
+        }
+        return P;
+    };
+    TestTrue(TEXT("8 nested bundles decode"), Decode(Nest(8), Msgs));
+    TestEqual(TEXT("8 nested bundles deliver the message"), Msgs.Num(), 1);
+    TestFalse(TEXT("9 nested bundles are rejected"), Decode(Nest(9), Msgs));
+    TestEqual(TEXT("9 nested bundles deliver nothing"), Msgs.Num(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCOscDecoderMalformedTest, "VMCLiveLink.OscDecoder.Malformed",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCOscDecoderMalformedTest::RunTest(const FString& Parameters)
+{
+    using namespace VMCOscTest;
+    TArray<FDecoded> Msgs;
+
+    auto ExpectRejected = [&](const TCHAR* What, const TArray<uint8>& Bytes)
+    {
+        TestFalse(What, Decode(Bytes, Msgs));
+    };
+
+    ExpectRejected(TEXT("Empty"), TArray<uint8>());
+    {
+        TArray<uint8> B = Message("/a", 1.f);
+        B.Pop();
+        ExpectRejected(TEXT("Size not a multiple of 4"), B);
+    }
+    {
+        TArray<uint8> B;
+        B.Init('a', 8);
+        B[0] = '/';
+        ExpectRejected(TEXT("Unterminated address"), B);
+    }
+    ExpectRejected(TEXT("Address without '/'"), FWriter().String("abc").String(",f").Float(1.f).Bytes);
+    ExpectRejected(TEXT("Type tags without ','"), FWriter().String("/a").String("f").Float(1.f).Bytes);
+    ExpectRejected(TEXT("Unknown type tag"), FWriter().String("/a").String(",x").U32(0).Bytes);
+    ExpectRejected(TEXT("Missing float payload"), FWriter().String("/a").String(",ff").Float(1.f).Bytes);
+    ExpectRejected(TEXT("More arguments than FVMCOscMessage holds"), FWriter().String("/a").String(",iiiiiiiiiiiiiiiii").Bytes);
+
+    // Sizes taken from the datagram must not wrap the bounds checks
+    ExpectRejected(TEXT("Bundle element size near INT32_MAX"),
+        FWriter().String("#bundle").U32(0).U32(1).U32(0x7FFFFFFCu).Raw(Message("/a", 1.f)).Bytes);
+    ExpectRejected(TEXT("Bundle element size with the sign bit set"),
+        FWriter().String("#bundle").U32(0).U32(1).U32(0xFFFFFFFCu).Raw(Message("/a", 1.f)).Bytes);
+    ExpectRejected(TEXT("Bundle element larger than the datagram"),
+        FWriter().String("#bundle").U32(0).U32(1).U32(64).Raw(Message("/a", 1.f)).Bytes);
+    ExpectRejected(TEXT("Unaligned bundle element size"),
+        FWriter().String("#bundle").U32(0).U32(1).U32(6).Raw(Message("/a", 1.f)).Bytes);
+    ExpectRejected(TEXT("Blob size near INT32_MAX"),
+        FWriter().String("/a").String(",b").U32(0x7FFFFFFCu).U32(0).Bytes);
+    ExpectRejected(TEXT("Blob larger than the datagram"),
+        FWriter().String("/a").String(",b").U32(16).U32(0).Bytes);
+
+    // Messages ahead of the error are still delivered
+    {
+        const TArray<uint8> B = FWriter().String("#bundle").U32(0).U32(1)
+            .Element(Message("/good", 1.f))
+            .U32(0x7FFFFFFCu).Raw(Message("/bad", 2.f)).Bytes;
+        TestFalse(TEXT("Bad second element"), Decode(B, Msgs));
+        TestEqual(TEXT("First element delivered"), Msgs.Num(), 1);
+    }
+
+    // Oversized but well-formed: a 60 KB blob decodes and keeps the following argument
+    {
+        TArray<uint8> Blob;
+        Blob.SetNumZeroed(60000);
+        const TArray<uint8> B = FWriter().String("/big").String(",bf").U32((uint32)Blob.Num()).Raw(Blob).Float(7.f).Bytes;
+        int32 Calls = 0;
+        const bool bOk = FVMCOscDecoder::DecodePacket(B.GetData(), B.Num(), [&](const FVMCOscMessage& M)
+        {
+            ++Calls;
+            TestEqual(TEXT("Argument after the blob"), M.Args[1].AsFloat(), 7.f);
+        });
+        TestTrue(TEXT("Large blob decodes"), bOk);
+        TestEqual(TEXT("Large blob message delivered"), Calls, 1);
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
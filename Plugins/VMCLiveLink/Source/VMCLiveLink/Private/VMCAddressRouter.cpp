@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCAddressRouter.h"
+
+namespace
+{
+    struct FRouteEntry
+    {
+        const UTF8CHAR* Address;
+        EVMCAddress Id;
+    };
+
+    // Add new protocol coverage here; lookup cost does not grow with this list
+    static const FRouteEntry GRoutes[] =
+    {
+        { UTF8TEXT("/VMC/Ext/Root/Pos"),    EVMCAddress::RootPos },
+        { UTF8TEXT("/VMC/Ext/Bone/Pos"),    EVMCAddress::BonePos },
+        { UTF8TEXT("/VMC/Ext/Blend/Val"),   EVMCAddress::BlendVal },
+        { UTF8TEXT("/VMC/Ext/Blend/Apply"), EVMCAddress::BlendApply },
+        { UTF8TEXT("/VMC/Ext/Tra/Pos"),     EVMCAddress::TrackerPos },
+        { UTF8TEXT("/VMC/Ext/Hmd/Pos"),     EVMCAddress::HmdPos },
+        { UTF8TEXT("/VMC/Ext/Con/Pos"),     EVMCAddress::ControllerPos },
+        { UTF8TEXT("/VMC/Ext/Cam"),         EVMCAddress::Camera },
+        { UTF8TEXT("/VMC/Ext/OK"),          EVMCAddress::Ok },
+        { UTF8TEXT("/VMC/Ext/T"),           EVMCAddress::Time },
+    };
+
+    // Power-of-two slot count, kept well above the route count so probes stay ~1
+    static constexpr uint32 NumSlots = 64;
+
+    struct FRouteTable
+    {
+        struct FSlot
+        {
+            uint32 Hash = 0;
+            int32 Len = 0;
+            const UTF8CHAR* Address = nullptr;
+            EVMCAddress Id = EVMCAddress::Unknown;
+        };
+        FSlot Slots[NumSlots];
+
+        FRouteTable()
+        {
+            static_assert(UE_ARRAY_COUNT(GRoutes) * 2 <= NumSlots, "Grow NumSlots");
+            for (const FRouteEntry& R : GRoutes)
+            {
+                const int32 Len = FCStringUtf8::Strlen(R.Address);
+                const uint32 H = FVMCAddressRouter::HashBytes(R.Address, Len);
+                uint32 i = H & (NumSlots - 1);
+                while (Slots[i].Address)
+                {
+                    i = (i + 1) & (NumSlots - 1);
+                }
+                Slots[i] = { H, Len, R.Address, R.Id };
+            }
+        }
+    };
+
+    static const FRouteTable& GetRouteTable()
+    {
+        static const FRouteTable Table;
+        return Table;
+    }
+}
+
+EVMCAddress FVMCAddressRouter::Resolve(FUtf8StringView Address)
+{
+    const FRouteTable& Table = GetRouteTable();
+
+    const int32 Len = Address.Len();
+    const uint32 H = HashBytes(Address.GetData(), Len);
+    for (uint32 i = H & (NumSlots - 1); Table.Slots[i].Address; i = (i + 1) & (NumSlots - 1))
+    {
+        const FRouteTable::FSlot& S = Table.Slots[i];
+        if (S.Hash == H && S.Len == Len && FMemory::Memcmp(S.Address, Address.GetData(), Len) == 0)
+        {
+            return S.Id;
+        }
+    }
+    return EVMCAddress::Unknown;
+}
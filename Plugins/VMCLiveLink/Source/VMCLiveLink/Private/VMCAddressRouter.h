@@ -0,0 +1,43 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Every VMC address the source understands (dense → usable as a jump-table index)
+enum class EVMCAddress : uint8
+{
+    Unknown = 0,
+    RootPos,        // /VMC/Ext/Root/Pos   (s name, 7f [, 3f scale, 3f offset])
+    BonePos,        // /VMC/Ext/Bone/Pos   (s bone, 7f)
+    BlendVal,       // /VMC/Ext/Blend/Val  (s curve, f)
+    BlendApply,     // /VMC/Ext/Blend/Apply
+    TrackerPos,     // /VMC/Ext/Tra/Pos    (s serial, 7f)
+    HmdPos,         // /VMC/Ext/Hmd/Pos    (s serial, 7f)
+    ControllerPos,  // /VMC/Ext/Con/Pos    (s serial, 7f)
+    Camera,         // /VMC/Ext/Cam        (s name, 7f, f fov)
+    Ok,             // /VMC/Ext/OK         (i loaded [, i calib state, i calib mode [, i tracking]])
+    Time,           // /VMC/Ext/T          (f time)
+
+    Count
+};
+
+/**
+ * Table-driven address lookup. The address bytes are hashed once (FNV-1a) and resolved
+ * through a small open-addressed table built from a static address list, so the cost per
+ * message depends on the address length only — not on how many addresses are supported.
+ */
+class FVMCAddressRouter
+{
+public:
+    static EVMCAddress Resolve(FUtf8StringView Address);
+
+    static constexpr uint32 HashBytes(const UTF8CHAR* Data, int32 Len)
+    {
+        uint32 H = 2166136261u;
+        for (int32 i = 0; i < Len; ++i)
+        {
+            H = (H ^ (uint8)Data[i]) * 16777619u;
+        }
+        return H;
+    }
+};
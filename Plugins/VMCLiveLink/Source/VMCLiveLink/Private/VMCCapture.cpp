@@ -0,0 +1,204 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCCapture.h"
+#include "VMCLog.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+
+static const uint8 CaptureMagic[6] = { 'V', 'M', 'C', 'C', 'A', 'P' };
+
+FString VMCCapture::ResolvePath(const FString& Path)
+{
+    return FPaths::IsRelative(Path) ? FPaths::Combine(FPaths::ProjectSavedDir(), Path) : Path;
+}
+
+// ---------------- Writer ----------------
+
+FVMCCaptureWriter::~FVMCCaptureWriter()
+{
+    Close();
+}
+
+bool FVMCCaptureWriter::Open(const FString& Path)
+{
+    Close();
+
+    FilePath = VMCCapture::ResolvePath(Path);
+    Ar.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+    if (!Ar.IsValid())
+    {
+        UE_LOG(LogVMCLiveLink, Error, TEXT("Could not create VMC capture '%s'"), *FilePath);
+        return false;
+    }
+
+    uint16 Version = VMCCapture::Version;
+    Ar->Serialize(const_cast<uint8*>(CaptureMagic), sizeof(CaptureMagic));
+    *Ar << Version;
+
+    StartSeconds = -1.0;   // set by the first datagram: an idle recorder adds no lead-in
+    NumDatagrams = 0;
+    NumBytes = 0;
+    UE_LOG(LogVMCLiveLink, Log, TEXT("Recording VMC traffic to '%s'"), *FilePath);
+    return true;
+}
+
+void FVMCCaptureWriter::Write(double ArrivalSeconds, uint32 FromIp, uint16 FromPort, const uint8* Data, int32 Size)
+{
+    if (!Ar.IsValid() || Size <= 0 || Size > MAX_uint16)
+    {
+        return;
+    }
+
+    if (StartSeconds < 0.0)
+    {
+        StartSeconds = ArrivalSeconds;
+    }
+    uint64 Micros = (uint64)FMath::Max((ArrivalSeconds - StartSeconds) * 1e6, 0.0);
+    uint16 Size16 = (uint16)Size;
+    *Ar << Micros << FromIp << FromPort << Size16;
+    Ar->Serialize(const_cast<uint8*>(Data), Size);
+
+    ++NumDatagrams;
+    NumBytes += Size;
+}
+
+void FVMCCaptureWriter::Close()
+{
+    if (Ar.IsValid())
+    {
+        Ar->Close();
+        Ar.Reset();
+        UE_LOG(LogVMCLiveLink, Log, TEXT("VMC capture '%s' closed: %llu datagrams, %llu bytes"), *FilePath, NumDatagrams, NumBytes);
+    }
+}
+
+// ---------------- Replayer ----------------
+
+FVMCCaptureReplayer::FVMCCaptureReplayer(FOnDatagram InOnDatagram)
+    : OnDatagram(MoveTemp(InOnDatagram))
+{
+}
+
+FVMCCaptureReplayer::~FVMCCaptureReplayer()
+{
+    Shutdown();
+}
+
+bool FVMCCaptureReplayer::Start(const FString& Path, bool bInRealtime, bool bInLoop, const FString& ThreadName)
+{
+    if (Thread)
+        return true;
+
+    FilePath = VMCCapture::ResolvePath(Path);
+    if (!FFileHelper::LoadFileToArray(Capture, *FilePath))
+    {
+        UE_LOG(LogVMCLiveLink, Error, TEXT("Could not read VMC capture '%s'"), *FilePath);
+        return false;
+    }
+    if (Capture.Num() < VMCCapture::HeaderSize || FMemory::Memcmp(Capture.GetData(), CaptureMagic, sizeof(CaptureMagic)) != 0)
+    {
+        UE_LOG(LogVMCLiveLink, Error, TEXT("'%s' is not a VMC capture"), *FilePath);
+        Capture.Empty();
+        return false;
+    }
+    uint16 Version;
+    FMemory::Memcpy(&Version, Capture.GetData() + sizeof(CaptureMagic), sizeof(Version));
+    if (Version != VMCCapture::Version)
+    {
+        UE_LOG(LogVMCLiveLink, Error, TEXT("VMC capture '%s' has format version %u; this build reads version %u"),
+            *FilePath, (uint32)Version, (uint32)VMCCapture::Version);
+        Capture.Empty();
+        return false;
+    }
+
+    bRealtime = bInRealtime;
+    bLoop = bInLoop;
+    bStopping = false;
+
+    Thread = FRunnableThread::Create(this, *ThreadName, 0, TPri_AboveNormal);
+    return Thread != nullptr;
+}
+
+void FVMCCaptureReplayer::Shutdown()
+{
+    if (Thread)
+    {
+        Thread->Kill(/*bShouldWait=*/true);
+        delete Thread;
+        Thread = nullptr;
+    }
+}
+
+uint32 FVMCCaptureReplayer::Run()
+{
+    const uint8* const Begin = Capture.GetData();
+    const uint8* const End = Begin + Capture.Num();
+
+    do
+    {
+        const double Start = FPlatformTime::Seconds();
+        uint64 NumDatagrams = 0, NumBytes = 0;
+        uint64 FirstMicros = 0;   // captures from older builds start at the recorder's Open()
+
+        const uint8* Cursor = Begin + VMCCapture::HeaderSize;
+        while (!bStopping && Cursor + VMCCapture::RecordHeaderSize <= End)
+        {
+            uint64 Micros; uint32 FromIp; uint16 FromPort, Size;
+            FMemory::Memcpy(&Micros, Cursor, 8);
+            FMemory::Memcpy(&FromIp, Cursor + 8, 4);
+            FMemory::Memcpy(&FromPort, Cursor + 12, 2);
+            FMemory::Memcpy(&Size, Cursor + 14, 2);
+            Cursor += VMCCapture::RecordHeaderSize;
+            if (Cursor + Size > End)
+            {
+                Cursor -= VMCCapture::RecordHeaderSize;
+                break;
+            }
+
+            if (NumDatagrams == 0)
+            {
+                FirstMicros = Micros;
+            }
+            if (bRealtime)
+            {
+                // Sleep most of the wait, spin the last millisecond so spacing matches the capture
+                const double Due = Start + (Micros - FirstMicros) * 1e-6;
+                for (double Now = FPlatformTime::Seconds(); Now < Due && !bStopping; Now = FPlatformTime::Seconds())
+                {
+                    FPlatformProcess::SleepNoStats(Due - Now > 0.002 ? (float)(Due - Now - 0.001) : 0.f);
+                }
+            }
+
+            OnDatagram(Cursor, Size, FromIp, FromPort);
+            Cursor += Size;
+            ++NumDatagrams;
+            NumBytes += Size;
+        }
+
+        const double Elapsed = FMath::Max(FPlatformTime::Seconds() - Start, 1e-9);
+        UE_LOG(LogVMCLiveLink, Log, TEXT("VMC replay '%s' (%s): %llu datagrams, %llu bytes in %.3fs (%.0f datagrams/s, %.1f MB/s)"),
+            *FilePath, bRealtime ? TEXT("realtime") : TEXT("max speed"), NumDatagrams, NumBytes, Elapsed,
+            NumDatagrams / Elapsed, NumBytes / Elapsed / (1024.0 * 1024.0));
+
+        // A bad capture would make looping spin (and log every pass): replay what is there once
+        if (!bStopping && Cursor != End)
+        {
+            UE_LOG(LogVMCLiveLink, Warning, TEXT("VMC capture '%s' is truncated%s"), *FilePath, bLoop ? TEXT("; not looping") : TEXT(""));
+            break;
+        }
+        if (NumDatagrams == 0)
+        {
+            if (bLoop)
+            {
+                UE_LOG(LogVMCLiveLink, Warning, TEXT("VMC capture '%s' has no datagrams; not looping"), *FilePath);
+            }
+            break;
+        }
+    } while (bLoop && !bStopping);
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+class FArchive;
+class FRunnableThread;
+
+/**
+ * Raw VMC capture file: every datagram as it came off the socket, with its arrival time and sender.
+ *   Header: "VMCCAP" + uint16 version (little-endian)
+ *   Record: uint64 microseconds since the first datagram, uint32 sender IPv4 (host order),
+ *           uint16 sender port, uint16 size, then size payload bytes
+ * Relative paths resolve against the project's Saved directory.
+ */
+namespace VMCCapture
+{
+    inline constexpr uint16 Version = 1;
+    inline constexpr int32 HeaderSize = 8;
+    inline constexpr int32 RecordHeaderSize = 16;
+
+    FString ResolvePath(const FString& Path);
+}
+
+// Appends datagrams to a capture file. Written from the port's ingest thread (buffered archive).
+class FVMCCaptureWriter
+{
+public:
+    ~FVMCCaptureWriter();
+
+    bool Open(const FString& Path);
+    void Write(double ArrivalSeconds, uint32 FromIp, uint16 FromPort, const uint8* Data, int32 Size);
+    void Close();
+
+private:
+    TUniquePtr<FArchive> Ar;
+    FString FilePath;
+    double StartSeconds = 0.0;
+    uint64 NumDatagrams = 0;
+    uint64 NumBytes = 0;
+};
+
+/**
+ * Feeds a capture's datagrams to a callback on its own thread, either at their original pace
+ * (relative to the first one) or as fast as possible. The callback gets the same arguments as
+ * FVMCUdpReceiver's, so replayed traffic takes the live decode path. Logs throughput at the end.
+ */
+class FVMCCaptureReplayer : public FRunnable
+{
+public:
+    using FOnDatagram = TFunction<void(const uint8* Data, int32 Size, uint32 FromIp, uint16 FromPort)>;
+
+    explicit FVMCCaptureReplayer(FOnDatagram InOnDatagram);
+    virtual ~FVMCCaptureReplayer() override;
+
+    // Loads the capture and starts the thread. False if the file is missing, not a capture, or
+    // written in another format version.
+    bool Start(const FString& Path, bool bInRealtime, bool bInLoop, const FString& ThreadName);
+
+    // Stops the thread (blocking, safe to call twice)
+    void Shutdown();
+
+    // FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override { bStopping = true; }
+
+private:
+    FOnDatagram OnDatagram;
+
+    TArray<uint8> Capture;   // whole file; payloads are handed out in place
+    FString FilePath;
+    bool bRealtime = true;
+    bool bLoop = false;
+
+    FRunnableThread* Thread = nullptr;
+    std::atomic<bool> bStopping{ false };
+};
@@ -0,0 +1,135 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCConcealment.h"
+
+namespace
+{
+    constexpr float VelocitySmoothing = 0.5f;   // weight of the newest velocity sample
+    constexpr double IntervalSmoothing = 0.1;
+}
+
+FVMCConcealer::FVMCConcealer(float InMaxExtrapolationMs, float InBlendMs)
+    : MaxExtrapolation(FMath::Max(InMaxExtrapolationMs, 0.f) * 0.001)
+    , BlendTime(FMath::Max(InBlendMs, 0.f) * 0.001)
+{
+}
+
+bool FVMCConcealer::IsInGap(double Now) const
+{
+    return NumHistory > 0 && Now - LastRealSeconds > GapThreshold();
+}
+
+void FVMCConcealer::EndGap(double Now)
+{
+    const double Gap = Now - LastRealSeconds;
+    ++Stats.Gaps;
+    Stats.LostFrames += (uint64)FMath::Max(FMath::RoundToInt64(Gap / Interval) - 1, (int64)0);
+    Stats.LongestGapMs = FMath::Max(Stats.LongestGapMs.load(), (float)(Gap * 1000.0));
+
+    // Blend out of the concealed pose; velocities restart from the next real pair
+    BlendStartSeconds = bConcealedAny ? Now : -1.0;
+    NumHistory = 1;
+    bInGap = false;
+    bConcealedAny = false;
+    bHolding = false;
+}
+
+void FVMCConcealer::OnRealFrame(double Now, TArray<FTransform>& Transforms)
+{
+    const int32 Num = Transforms.Num();
+    if (Num != LastRotation.Num())
+    {
+        // New layout: history and blend source no longer line up
+        LastRotation.SetNumUninitialized(Num);
+        LastTranslation.SetNumUninitialized(Num);
+        AngularVelocity.Init(FVector::ZeroVector, Num);
+        LinearVelocity.Init(FVector::ZeroVector, Num);
+        NumHistory = 0;
+        bInGap = false;
+        bConcealedAny = false;
+        bHolding = false;
+        BlendStartSeconds = -1.0;
+    }
+
+    if (bInGap)
+    {
+        EndGap(Now);
+    }
+
+    // Velocity history from the real (unblended) pose
+    const double Dt = Now - LastRealSeconds;
+    if (NumHistory > 0 && Dt > UE_KINDA_SMALL_NUMBER)
+    {
+        const float InvDt = (float)(1.0 / Dt);
+        const float W = NumHistory >= 2 ? VelocitySmoothing : 1.f;
+        for (int32 i = 0; i < Num; ++i)
+        {
+            const FQuat Delta = Transforms[i].GetRotation() * LastRotation[i].Inverse();
+            AngularVelocity[i] = FMath::Lerp(AngularVelocity[i], Delta.ToRotationVector() * InvDt, W);
+            LinearVelocity[i] = FMath::Lerp(LinearVelocity[i], (Transforms[i].GetTranslation() - LastTranslation[i]) * InvDt, W);
+        }
+        if (NumHistory >= 2)
+        {
+            Interval += (Dt - Interval) * IntervalSmoothing;
+        }
+        NumHistory = 2;
+    }
+    else
+    {
+        NumHistory = FMath::Max(NumHistory, 1);
+    }
+
+    for (int32 i = 0; i < Num; ++i)
+    {
+        LastRotation[i] = Transforms[i].GetRotation();
+        LastTranslation[i] = Transforms[i].GetTranslation();
+    }
+    LastRealSeconds = Now;
+
+    // Ease from the last concealed pose to the live one
+    if (BlendStartSeconds >= 0.0)
+    {
+        const double Alpha = BlendTime > 0.0 ? (Now - BlendStartSeconds) / BlendTime : 1.0;
+        if (Alpha >= 1.0 || Scratch.Num() != Num)
+        {
+            BlendStartSeconds = -1.0;
+        }
+        else
+        {
+            const float A = FMath::SmoothStep(0.f, 1.f, (float)Alpha);
+            for (int32 i = 0; i < Num; ++i)
+            {
+                FTransform& T = Transforms[i];
+                T.SetRotation(FQuat::Slerp(Scratch[i].GetRotation(), T.GetRotation(), A));
+                T.SetTranslation(FMath::Lerp(Scratch[i].GetTranslation(), T.GetTranslation(), A));
+            }
+        }
+    }
+}
+
+bool FVMCConcealer::Extrapolate(double Now, TArray<FTransform>& Out)
+{
+    bInGap = true;
+    if (NumHistory < 2 || bHolding || MaxExtrapolation <= 0.0)
+    {
+        return false;
+    }
+
+    // Velocities fall off linearly to zero at the window's end, so the pose eases to a stop
+    // instead of flying off: effective time = E - E²/(2·Max)
+    const double E = FMath::Min(Now - LastRealSeconds, MaxExtrapolation);
+    const float T = (float)(E - E * E / (2.0 * MaxExtrapolation));
+    bHolding = E >= MaxExtrapolation;
+
+    const int32 Num = LastRotation.Num();
+    Scratch.SetNumUninitialized(Num, EAllowShrinking::No);
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const FQuat Q = FQuat::MakeFromRotationVector(AngularVelocity[i] * T) * LastRotation[i];
+        Scratch[i] = FTransform(Q.GetNormalized(), LastTranslation[i] + LinearVelocity[i] * T, FVector::OneVector);
+    }
+
+    Out = Scratch;
+    bConcealedAny = true;
+    ++Stats.ConcealedFrames;
+    return true;
+}
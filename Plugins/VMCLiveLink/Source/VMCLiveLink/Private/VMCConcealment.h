@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Loss / gap counters (written by the concealer, read from any thread)
+struct FVMCConcealStats
+{
+    std::atomic<uint64> Gaps{ 0 };            // stalls longer than the gap threshold
+    std::atomic<uint64> LostFrames{ 0 };      // estimated sender frames missing across all gaps
+    std::atomic<uint64> ConcealedFrames{ 0 }; // extrapolated frames pushed
+    std::atomic<float>  LongestGapMs{ 0.f };
+};
+
+/**
+ * Packet-loss concealment for one subject's output pose (local transforms, Live Link order).
+ * Real frames feed a short velocity history per bone (angular + linear, smoothed over the last
+ * few frames). When frames stop arriving for longer than ~1.5 sender intervals the pose is
+ * extrapolated from that history for a bounded window and then held; when real data resumes
+ * the output blends from the last concealed pose back to the live one.
+ * Not thread-safe: called by whoever pushes the subject's frames, under the performer's push lock.
+ */
+class FVMCConcealer
+{
+public:
+    FVMCConcealer(float InMaxExtrapolationMs, float InBlendMs);
+
+    // Real frame at local time Now: updates history and, right after a gap, blends Transforms
+    // in place from the concealed pose toward the live one
+    void OnRealFrame(double Now, TArray<FTransform>& Transforms);
+
+    // True when no real frame arrived for longer than the gap threshold
+    bool IsInGap(double Now) const;
+
+    // Extrapolated pose for Now into Out. False once the window is used up (or without history):
+    // the last pushed pose then simply holds.
+    bool Extrapolate(double Now, TArray<FTransform>& Out);
+
+    const FVMCConcealStats& GetStats() const { return Stats; }
+
+private:
+    double GapThreshold() const { return Interval * 1.5; }
+    void EndGap(double Now);
+
+    const double MaxExtrapolation;
+    const double BlendTime;
+
+    // History (by output bone)
+    TArray<FQuat>   LastRotation;
+    TArray<FVector> LastTranslation;
+    TArray<FVector> AngularVelocity;   // axis × rad/s, parent space
+    TArray<FVector> LinearVelocity;    // cm/s, parent space
+    TArray<FTransform> Scratch;        // concealed pose (blend source after a gap)
+    double LastRealSeconds = -1.0;
+    double Interval = 1.0 / 60.0;      // smoothed real-frame interval
+    int32 NumHistory = 0;              // real frames seen since the last layout change (saturates at 2)
+
+    // Gap / blend state
+    bool bInGap = false;
+    bool bConcealedAny = false;        // this gap pushed at least one extrapolated pose
+    bool bHolding = false;             // window used up; the last concealed pose stands
+    double BlendStartSeconds = -1.0;
+
+    FVMCConcealStats Stats;
+};
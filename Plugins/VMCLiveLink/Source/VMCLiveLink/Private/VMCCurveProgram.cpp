@@ -0,0 +1,143 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCCurveProgram.h"
+
+void FVMCCurveProgram::AddMirrorOutputs(const TArray<FVMCCurveRule>& Rules, TArray<FName>& InOutNames)
+{
+	for (const FVMCCurveRule& Rule : Rules)
+	{
+		if (Rule.Op != EVMCCurveOp::Mirror || !Rule.bAddMissingOutput || Rule.Output.IsNone() || Rule.Inputs.Num() == 0 || InOutNames.Contains(Rule.Output))
+		{
+			continue;
+		}
+		if (InOutNames.Contains(Rule.Inputs[0]))
+		{
+			InOutNames.Add(Rule.Output);
+		}
+	}
+}
+
+TSharedPtr<FVMCCurveProgram, ESPMode::ThreadSafe> FVMCCurveProgram::Compile(const TArray<FVMCCurveRule>& Rules, const TArray<FName>& Names, int32 NumSentNames)
+{
+	TSharedPtr<FVMCCurveProgram, ESPMode::ThreadSafe> Program = MakeShared<FVMCCurveProgram, ESPMode::ThreadSafe>();
+	Program->NamesHash = HashNames(Names);
+	Program->NumNames = Names.Num();
+	if (Rules.Num() == 0)
+	{
+		return Program;
+	}
+
+	TMap<FName, int32> SlotByName;
+	SlotByName.Reserve(Names.Num());
+	for (int32 i = 0; i < Names.Num(); ++i)
+	{
+		SlotByName.FindOrAdd(Names[i], i);
+	}
+
+	for (const FVMCCurveRule& Rule : Rules)
+	{
+		const int32* Output = SlotByName.Find(Rule.Output);
+		if (!Output)
+		{
+			continue;
+		}
+		// Mirror only fills curves that were added because the sender lacks them
+		if (Rule.Op == EVMCCurveOp::Mirror && *Output < NumSentNames)
+		{
+			continue;
+		}
+
+		FVMCCurveInstr I;
+		I.Op = Rule.Op;
+		I.bClampToUnit = Rule.bClampToUnit;
+		I.Output = *Output;
+		I.Scale = Rule.Scale;
+		I.ClampMin = Rule.ClampMin;
+		I.ClampMax = Rule.ClampMax;
+		I.FirstInput = Program->InputSlots.Num();
+
+		const bool bUnary = Rule.Op != EVMCCurveOp::Max && Rule.Op != EVMCCurveOp::Min && Rule.Op != EVMCCurveOp::Blend;
+		const int32 NumRuleInputs = bUnary ? FMath::Min(Rule.Inputs.Num(), 1) : Rule.Inputs.Num();
+		for (int32 k = 0; k < NumRuleInputs; ++k)
+		{
+			if (const int32* In = SlotByName.Find(Rule.Inputs[k]))
+			{
+				Program->InputSlots.Add(*In);
+				Program->InputWeights.Add(Rule.Weights.IsValidIndex(k) ? Rule.Weights[k] : 0.f);
+			}
+		}
+		if (Rule.Op == EVMCCurveOp::Clamp && Rule.Inputs.Num() == 0)
+		{
+			Program->InputSlots.Add(*Output);   // clamp in place
+			Program->InputWeights.Add(0.f);
+		}
+
+		I.NumInputs = (int16)(Program->InputSlots.Num() - I.FirstInput);
+		if (I.NumInputs == 0)
+		{
+			continue;   // none of its inputs are carried by the subject
+		}
+		if (Rule.Op == EVMCCurveOp::Blend && Rule.Weights.Num() != Rule.Inputs.Num())
+		{
+			for (int32 k = 0; k < I.NumInputs; ++k)
+			{
+				Program->InputWeights[I.FirstInput + k] = 1.f / I.NumInputs;
+			}
+		}
+		Program->Code.Add(I);
+	}
+	return Program;
+}
+
+uint32 FVMCCurveProgram::HashNames(const TArray<FName>& Names)
+{
+	uint32 H = GetTypeHash(Names.Num());
+	for (const FName& N : Names)
+	{
+		H = HashCombineFast(H, GetTypeHash(N));
+	}
+	return H;
+}
+
+void FVMCCurveProgram::Execute(TArray<float>& Values) const
+{
+	if (Values.Num() < NumNames)
+	{
+		return;   // frame does not match the names this was compiled for
+	}
+
+	float* V = Values.GetData();
+	const int32* Slots = InputSlots.GetData();
+	const float* Weights = InputWeights.GetData();
+	for (const FVMCCurveInstr& I : Code)
+	{
+		const int32* In = Slots + I.FirstInput;
+		float Out = V[In[0]];
+		switch (I.Op)
+		{
+		case EVMCCurveOp::Scale:
+		case EVMCCurveOp::Mirror:
+			Out *= I.Scale;
+			break;
+		case EVMCCurveOp::Clamp:
+			Out = FMath::Clamp(Out, I.ClampMin, I.ClampMax);
+			break;
+		case EVMCCurveOp::Max:
+			for (int32 k = 1; k < I.NumInputs; ++k) Out = FMath::Max(Out, V[In[k]]);
+			break;
+		case EVMCCurveOp::Min:
+			for (int32 k = 1; k < I.NumInputs; ++k) Out = FMath::Min(Out, V[In[k]]);
+			break;
+		case EVMCCurveOp::Blend:
+			Out *= Weights[I.FirstInput];
+			for (int32 k = 1; k < I.NumInputs; ++k) Out += Weights[I.FirstInput + k] * V[In[k]];
+			break;
+		default:
+			break;
+		}
+		if (I.bClampToUnit)
+		{
+			Out = FMath::Clamp(Out, 0.f, 1.f);
+		}
+		V[I.Output] = Out;
+	}
+}
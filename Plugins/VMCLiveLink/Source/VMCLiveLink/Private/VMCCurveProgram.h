@@ -0,0 +1,50 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VMCCurveRules.h"
+
+// One compiled rule: slots are PropertyValues indices, inputs a range of the program's operand arrays
+struct FVMCCurveInstr
+{
+	EVMCCurveOp Op = EVMCCurveOp::Copy;
+	bool bClampToUnit = true;
+	int16 NumInputs = 0;
+	int32 FirstInput = 0;
+	int32 Output = INDEX_NONE;
+	float Scale = 1.f;
+	float ClampMin = 0.f;
+	float ClampMax = 1.f;
+};
+
+/**
+ * Curve rules compiled against one subject's property names: a flat, index-based instruction
+ * list evaluated over PropertyValues in a single pass, with no name lookups per frame.
+ * Immutable once built; shared by pointer.
+ */
+struct FVMCCurveProgram
+{
+	TArray<FVMCCurveInstr> Code;
+	TArray<int32> InputSlots;      // operands of all instructions, back to back
+	TArray<float> InputWeights;    // Blend weights, parallel to InputSlots
+
+	// Identity of the names the slots were resolved against
+	uint32 NamesHash = 0;
+	int32 NumNames = 0;
+	const FName* BoundNames = nullptr;  // PropertyNames storage it was last matched to (nullptr = not yet)
+
+	bool IsEmpty() const { return Code.Num() == 0; }
+
+	// Mirror outputs the sender does not provide become new property names when the rule asks
+	// for it (bAddMissingOutput; static data remap)
+	static void AddMirrorOutputs(const TArray<FVMCCurveRule>& Rules, TArray<FName>& InOutNames);
+
+	static TSharedPtr<FVMCCurveProgram, ESPMode::ThreadSafe> Compile(const TArray<FVMCCurveRule>& Rules, const TArray<FName>& Names, int32 NumSentNames);
+
+	static uint32 HashNames(const TArray<FName>& Names);
+
+	// Runs the program over a frame's values (sized to the names it was compiled against)
+	void Execute(TArray<float>& Values) const;
+};
+
+using FVMCCurveProgramPtr = TSharedPtr<const FVMCCurveProgram, ESPMode::ThreadSafe>;
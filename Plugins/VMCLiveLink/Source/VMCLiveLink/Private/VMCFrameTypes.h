@@ -0,0 +1,122 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/TripleBuffer.h"
+#include "VMCLiveLinkSourceStats.h"
+#include <atomic>
+
+// How a bone's output translation is produced (decided once per layout, not per frame)
+enum class EVMCTranslationPolicy : uint8
+{
+    Root,             // incoming translation; synthesized root takes the /Root/Pos transform
+    RefOffset,        // reference-pose local translation
+    Incoming,         // incoming translation as sent
+    IncomingElseRef,  // incoming unless ~zero, then reference-pose translation
+    Zero              // no source for translation
+};
+
+// One output bone of the compiled plan
+struct FVMCBonePlan
+{
+    FVector RefTranslation = FVector::ZeroVector;
+    int32 Slot = INDEX_NONE;          // pose slot to read
+    int32 Parent = INDEX_NONE;
+    EVMCTranslationPolicy Policy = EVMCTranslationPolicy::Zero;
+};
+
+/**
+ * Immutable description of a subject's static data plus its compiled output plan.
+ * Rebuilt by the receive thread only when something static changes (names, remap maps,
+ * reference skeleton) and shared by pointer with every frame that uses it, so pushes
+ * never copy names or do map lookups.
+ */
+struct FVMCStaticLayout
+{
+    TArray<FName> BoneNames;         // output order (source names)
+    TArray<int32> BoneParents;       // -1 for root
+    TArray<FName> MappedBoneNames;   // BoneNames through the bone map (static data)
+    TArray<FName> MappedCurveNames;  // curve names through the curve map (static data)
+
+    // Compiled plan: a linear pass over these produces a frame
+    TArray<FVMCBonePlan> BonePlan;   // output index → {slot, parent, ref translation, policy}
+    TArray<int32> CurveSlots;        // property index → curve slot
+
+    uint32 Version = 0;
+};
+
+using FVMCStaticLayoutPtr = TSharedPtr<const FVMCStaticLayout, ESPMode::ThreadSafe>;
+
+// One committed frame of dense, slot-indexed samples
+struct FVMCFrameSnapshot
+{
+    FVMCStaticLayoutPtr Layout;
+
+    TArray<FTransform> Pose;        // by bone slot
+    TArray<uint8>      PoseValid;   // by bone slot
+    FTransform         Root = FTransform::Identity;
+    TArray<float>      Curves;      // by curve slot
+    TArray<uint8>      CurveValid;  // by curve slot
+
+    uint64 Sequence = 0;
+    double CommitSeconds = 0.0;     // FPlatformTime::Seconds() at commit
+    double WorldSeconds = 0.0;      // Live Link WorldTime (sender time mapped to the local clock, else CommitSeconds)
+    double SenderSeconds = -1.0;    // bundle timetag, seconds since 1900 UTC (<0 = none)
+    uint64 IngestCycles = 0;        // FPlatformTime::Cycles64() when the frame's first sample was handled
+};
+
+// Hand-off counters (commit side: Committed/Coalesced, push side: the rest; read from any thread)
+struct FVMCOutputStats
+{
+    std::atomic<uint64> Committed{ 0 };
+    std::atomic<uint64> Pushed{ 0 };
+    std::atomic<uint64> Coalesced{ 0 };   // replaced by a newer commit before it was pushed
+    std::atomic<uint64> Suppressed{ 0 };  // within the idle deadband of the last push (not sent)
+    std::atomic<uint64> StaticPushes{ 0 };// static data published
+    std::atomic<uint64> PushCycles{ 0 };  // time in the push step
+    std::atomic<uint64> Latency[FVMCLiveLinkSourceStats::NumLatencyBuckets] = {};       // ingest → push
+    std::atomic<uint64> ApplyLatency[FVMCLiveLinkSourceStats::NumLatencyBuckets] = {};  // commit → push
+};
+
+/**
+ * Lock-free hand-off of committed frames from the receive thread (single writer) to the
+ * push step (single reader). Buffers keep their capacity, so steady-state commits copy
+ * dense arrays without allocating.
+ */
+class FVMCFrameExchange
+{
+public:
+    // Writer: the buffer to fill for the next commit
+    FVMCFrameSnapshot& BeginWrite() { return Buffers.GetWriteBuffer(); }
+
+    // Writer: publish what was filled since BeginWrite
+    void Publish() { Buffers.SwapWriteBuffers(); }
+
+    // Writer: the last published frame has not been consumed yet (the next Publish replaces it)
+    bool HasUnconsumed() const { return Buffers.IsDirty(); }
+
+    // Reader: latest published frame, or nullptr if nothing new since the last call
+    const FVMCFrameSnapshot* ConsumeLatest()
+    {
+        if (!Buffers.IsDirty())
+        {
+            return nullptr;
+        }
+        Buffers.SwapReadBuffers();
+        return &Buffers.Read();
+    }
+
+    // Copies Src into Dst reusing Dst's allocation (element types here are trivially copyable)
+    template<typename T>
+    static void CopyDense(TArray<T>& Dst, const TArray<T>& Src)
+    {
+        Dst.SetNumUninitialized(Src.Num(), EAllowShrinking::No);
+        if (Src.Num() > 0)
+        {
+            FMemory::Memcpy(Dst.GetData(), Src.GetData(), Src.Num() * sizeof(T));
+        }
+    }
+
+private:
+    TTripleBuffer<FVMCFrameSnapshot> Buffers;
+};
@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Built-in skeleton for VMC senders: Unity's HumanBodyBones under a synthesized "root"
+ * (fed by /VMC/Ext/Root/Pos). Entries are in parent-before-child order and Parent indexes
+ * this table, so it can be copied straight into a subject's bone arrays.
+ * Neck and both shoulders hang off UpperChest; avatars without one send Neck/shoulder
+ * rotations relative to Chest, which composes the same through an identity UpperChest.
+ */
+struct FVMCHumanoidBone
+{
+    const UTF8CHAR* Name;
+    int32 Parent;
+};
+
+namespace VMCHumanoidSchema
+{
+    inline constexpr int32 Root = 0;
+    inline constexpr int32 Hips = 1;   // carries the live body translation
+
+    inline constexpr FVMCHumanoidBone Bones[] =
+    {
+        { UTF8TEXT("root"),                     -1 }, //  0
+        { UTF8TEXT("Hips"),                      0 }, //  1
+        { UTF8TEXT("Spine"),                     1 }, //  2
+        { UTF8TEXT("Chest"),                     2 }, //  3
+        { UTF8TEXT("UpperChest"),                3 }, //  4
+        { UTF8TEXT("Neck"),                      4 }, //  5
+        { UTF8TEXT("Head"),                      5 }, //  6
+        { UTF8TEXT("LeftEye"),                   6 }, //  7
+        { UTF8TEXT("RightEye"),                  6 }, //  8
+        { UTF8TEXT("Jaw"),                       6 }, //  9
+
+        { UTF8TEXT("LeftUpperLeg"),              1 }, // 10
+        { UTF8TEXT("LeftLowerLeg"),             10 }, // 11
+        { UTF8TEXT("LeftFoot"),                 11 }, // 12
+        { UTF8TEXT("LeftToes"),                 12 }, // 13
+        { UTF8TEXT("RightUpperLeg"),             1 }, // 14
+        { UTF8TEXT("RightLowerLeg"),            14 }, // 15
+        { UTF8TEXT("RightFoot"),                15 }, // 16
+        { UTF8TEXT("RightToes"),                16 }, // 17
+
+        { UTF8TEXT("LeftShoulder"),              4 }, // 18
+        { UTF8TEXT("LeftUpperArm"),             18 }, // 19
+        { UTF8TEXT("LeftLowerArm"),             19 }, // 20
+        { UTF8TEXT("LeftHand"),                 20 }, // 21
+        { UTF8TEXT("LeftThumbProximal"),        21 }, // 22
+        { UTF8TEXT("LeftThumbIntermediate"),    22 }, // 23
+        { UTF8TEXT("LeftThumbDistal"),          23 }, // 24
+        { UTF8TEXT("LeftIndexProximal"),        21 }, // 25
+        { UTF8TEXT("LeftIndexIntermediate"),    25 }, // 26
+        { UTF8TEXT("LeftIndexDistal"),          26 }, // 27
+        { UTF8TEXT("LeftMiddleProximal"),       21 }, // 28
+        { UTF8TEXT("LeftMiddleIntermediate"),   28 }, // 29
+        { UTF8TEXT("LeftMiddleDistal"),         29 }, // 30
+        { UTF8TEXT("LeftRingProximal"),         21 }, // 31
+        { UTF8TEXT("LeftRingIntermediate"),     31 }, // 32
+        { UTF8TEXT("LeftRingDistal"),           32 }, // 33
+        { UTF8TEXT("LeftLittleProximal"),       21 }, // 34
+        { UTF8TEXT("LeftLittleIntermediate"),   34 }, // 35
+        { UTF8TEXT("LeftLittleDistal"),         35 }, // 36
+
+        { UTF8TEXT("RightShoulder"),             4 }, // 37
+        { UTF8TEXT("RightUpperArm"),            37 }, // 38
+        { UTF8TEXT("RightLowerArm"),            38 }, // 39
+        { UTF8TEXT("RightHand"),                39 }, // 40
+        { UTF8TEXT("RightThumbProximal"),       40 }, // 41
+        { UTF8TEXT("RightThumbIntermediate"),   41 }, // 42
+        { UTF8TEXT("RightThumbDistal"),         42 }, // 43
+        { UTF8TEXT("RightIndexProximal"),       40 }, // 44
+        { UTF8TEXT("RightIndexIntermediate"),   44 }, // 45
+        { UTF8TEXT("RightIndexDistal"),         45 }, // 46
+        { UTF8TEXT("RightMiddleProximal"),      40 }, // 47
+        { UTF8TEXT("RightMiddleIntermediate"),  47 }, // 48
+        { UTF8TEXT("RightMiddleDistal"),        48 }, // 49
+        { UTF8TEXT("RightRingProximal"),        40 }, // 50
+        { UTF8TEXT("RightRingIntermediate"),    50 }, // 51
+        { UTF8TEXT("RightRingDistal"),          51 }, // 52
+        { UTF8TEXT("RightLittleProximal"),      40 }, // 53
+        { UTF8TEXT("RightLittleIntermediate"),  53 }, // 54
+        { UTF8TEXT("RightLittleDistal"),        54 }, // 55
+    };
+
+    inline constexpr int32 NumBones = UE_ARRAY_COUNT(Bones);
+}
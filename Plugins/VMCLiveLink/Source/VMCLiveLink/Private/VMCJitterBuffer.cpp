@@ -0,0 +1,225 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCJitterBuffer.h"
+#include "VMCLog.h"
+
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+
+static constexpr double ReanchorGap = 0.25;        // arrival gap / clock error that restarts the media clock
+static constexpr double JitterMultiplier = 3.0;    // adaptive delay = this × jitter (covers ~99% of arrivals)
+static constexpr double DelaySmoothing = 0.02;     // per frame; keeps playout from jumping when the goal moves
+static constexpr uint32 IdleWaitMs = 50;           // upper bound on a playout sleep (shutdown responsiveness)
+
+FVMCJitterBuffer::FVMCJitterBuffer(FOnPlayout InOnPlayout, float InTargetMs, float InMaxMs, bool bInAdaptive)
+    : OnPlayout(MoveTemp(InOnPlayout))
+    , TargetDelay(FMath::Max(InTargetMs, 0.f) * 0.001)
+    , MaxDelay(FMath::Max(InMaxMs, InTargetMs) * 0.001)
+    , bAdaptive(bInAdaptive)
+{
+    Delay = TargetDelay;
+}
+
+FVMCFrameSnapshot* FVMCJitterBuffer::BeginWrite()
+{
+    const uint32 T = Tail.load(std::memory_order_relaxed);
+    if (T - Head.load(std::memory_order_acquire) >= (uint32)Capacity)
+    {
+        ++Stats.Overflow;
+        return nullptr;
+    }
+    return &Slots[T & (Capacity - 1)].Frame;
+}
+
+void FVMCJitterBuffer::Publish()
+{
+    const uint32 T = Tail.load(std::memory_order_relaxed);
+    FSlot& S = Slots[T & (Capacity - 1)];
+    S.DueSeconds = ScheduleFrame(S.Frame);
+    Tail.store(T + 1, std::memory_order_release);
+
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+double FVMCJitterBuffer::ScheduleFrame(const FVMCFrameSnapshot& Frame)
+{
+    const double Arrival = Frame.CommitSeconds;
+
+    // Media time: sender clock when we have it, else a smoothed arrival clock
+    double Media;
+    if (Frame.SenderSeconds >= 0.0)
+    {
+        Media = Frame.WorldSeconds;
+    }
+    else if (LastArrival < 0.0 || Arrival - LastArrival > ReanchorGap)
+    {
+        Media = Arrival;
+    }
+    else
+    {
+        Interval += ((Arrival - LastArrival) - Interval) * 0.05;
+        const double Expected = LastMedia + Interval;
+        Media = (FMath::Abs(Arrival - Expected) > ReanchorGap) ? Arrival : Expected + (Arrival - Expected) * 0.1;
+    }
+
+    // RFC 3550 interarrival jitter on transit time
+    const double Transit = Arrival - Media;
+    if (LastArrival >= 0.0)
+    {
+        Jitter += (FMath::Abs(Transit - LastTransit) - Jitter) / 16.0;
+    }
+    LastArrival = Arrival;
+    LastMedia = Media;
+    LastTransit = Transit;
+
+    if (bAdaptive)
+    {
+        const double Goal = FMath::Clamp(JitterMultiplier * Jitter, TargetDelay, MaxDelay);
+        Delay += (Goal - Delay) * DelaySmoothing;
+    }
+
+    double Due = Media + Delay;
+    if (Due < Arrival)
+    {
+        ++Stats.Late;
+        Due = Arrival;
+    }
+    else if (Due - Arrival > MaxDelay)
+    {
+        ++Stats.Early;
+        Due = Arrival + MaxDelay;
+    }
+
+    // Never reorder playout
+    Due = FMath::Max(Due, LastDue);
+    LastDue = Due;
+
+    Stats.DelayMs.store(float(Delay * 1000.0), std::memory_order_relaxed);
+    Stats.JitterMs.store(float(Jitter * 1000.0), std::memory_order_relaxed);
+    return Due;
+}
+
+double FVMCJitterBuffer::PlayDue(double Now)
+{
+    uint32 H = Head.load(std::memory_order_relaxed);
+    const uint32 T = Tail.load(std::memory_order_acquire);
+    if (H == T)
+    {
+        return MAX_dbl;
+    }
+    if (Slots[H & (Capacity - 1)].DueSeconds > Now)
+    {
+        return Slots[H & (Capacity - 1)].DueSeconds;
+    }
+
+    // Play only the newest frame that is due
+    while (H + 1 != T && Slots[(H + 1) & (Capacity - 1)].DueSeconds <= Now)
+    {
+        ++H;
+        ++Stats.Skipped;
+    }
+
+    OnPlayout(Slots[H & (Capacity - 1)].Frame);
+    ++Stats.Pushed;
+    Head.store(H + 1, std::memory_order_release);
+
+    return (H + 1 != T) ? Slots[(H + 1) & (Capacity - 1)].DueSeconds : MAX_dbl;
+}
+
+// ---------------- Playout thread ----------------
+
+FVMCPlayoutThread::~FVMCPlayoutThread()
+{
+    Shutdown();
+}
+
+bool FVMCPlayoutThread::Start(const FString& ThreadName)
+{
+    if (Thread)
+        return true;
+
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(/*bIsManualReset=*/false);
+    bStopping = false;
+
+    Thread = FRunnableThread::Create(this, *ThreadName, 0, TPri_AboveNormal);
+    if (!Thread)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void FVMCPlayoutThread::Shutdown()
+{
+    if (Thread)
+    {
+        Thread->Kill(/*bShouldWait=*/true); // calls Stop() and joins
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    {
+        FScopeLock Lock(&BuffersLock);
+        for (FVMCJitterBuffer* B : Buffers)
+        {
+            B->WakeEvent = nullptr;
+        }
+        Buffers.Reset();
+    }
+
+    if (WakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+    }
+}
+
+void FVMCPlayoutThread::Register(FVMCJitterBuffer* Buffer)
+{
+    FScopeLock Lock(&BuffersLock);
+    Buffer->WakeEvent = WakeEvent;
+    Buffers.AddUnique(Buffer);
+}
+
+void FVMCPlayoutThread::Stop()
+{
+    bStopping = true;
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+uint32 FVMCPlayoutThread::Run()
+{
+    TArray<FVMCJitterBuffer*, TInlineAllocator<16>> Local;
+
+    while (!bStopping)
+    {
+        {
+            FScopeLock Lock(&BuffersLock);
+            Local.Reset();
+            Local.Append(Buffers);
+        }
+
+        const double Now = FPlatformTime::Seconds();
+        double NextDue = MAX_dbl;
+        for (FVMCJitterBuffer* B : Local)
+        {
+            NextDue = FMath::Min(NextDue, B->PlayDue(Now));
+        }
+
+        // Sleep until the earliest head falls due (a publish wakes us too; it can't be due earlier)
+        const double WaitMs = (NextDue - FPlatformTime::Seconds()) * 1000.0;
+        if (WaitMs > 0.0)
+        {
+            WakeEvent->Wait(WaitMs >= IdleWaitMs ? IdleWaitMs : FMath::Max<uint32>(1, (uint32)WaitMs));
+        }
+    }
+    return 0;
+}
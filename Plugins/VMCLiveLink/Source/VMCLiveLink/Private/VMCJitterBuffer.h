@@ -0,0 +1,117 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/CriticalSection.h"
+#include "VMCFrameTypes.h"
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+
+// Playout counters (written by the jitter buffer, read from any thread)
+struct FVMCJitterStats
+{
+    std::atomic<uint64> Pushed{ 0 };     // frames handed to Live Link
+    std::atomic<uint64> Late{ 0 };       // arrived after their playout time (played immediately)
+    std::atomic<uint64> Early{ 0 };      // arrived further ahead than the max latency (pulled in)
+    std::atomic<uint64> Skipped{ 0 };    // superseded by a newer due frame before they were played
+    std::atomic<uint64> Overflow{ 0 };   // ring full at commit (frame dropped)
+    std::atomic<float>  DelayMs{ 0.f };  // current playout delay
+    std::atomic<float>  JitterMs{ 0.f }; // RFC 3550 interarrival jitter estimate
+};
+
+/**
+ * Optional stage between frame commit and PushSubjectFrameData_AnyThread.
+ * Committed frames go into a small single-producer/single-consumer ring stamped with a playout
+ * time = media time + delay. Media time is the sender-mapped WorldTime when the bundle carried a
+ * timetag, else a smoothed arrival clock (nominal frame interval, re-anchored on gaps). The delay
+ * starts at the target latency and, when adaptive, follows a multiple of the measured jitter up to
+ * the max latency. The playout thread (FVMCPlayoutThread, shared by every buffer of a source)
+ * pushes each frame when it falls due; older due frames are skipped so a stall never turns into a burst.
+ */
+class FVMCJitterBuffer
+{
+public:
+    // Called on the playout thread
+    using FOnPlayout = TFunction<void(const FVMCFrameSnapshot& Frame)>;
+
+    static constexpr int32 Capacity = 32; // power of two; ~130 ms at 240 Hz
+
+    FVMCJitterBuffer(FOnPlayout InOnPlayout, float InTargetMs, float InMaxMs, bool bInAdaptive);
+
+    // Writer (commit thread): slot to fill, or nullptr when the ring is full
+    FVMCFrameSnapshot* BeginWrite();
+
+    // Writer: schedules the frame filled since BeginWrite
+    void Publish();
+
+    // Reader (playout thread): plays the newest due frame, returns when the next one falls due (or MAX_dbl)
+    double PlayDue(double Now);
+
+    const FVMCJitterStats& GetStats() const { return Stats; }
+
+private:
+    friend class FVMCPlayoutThread;
+
+    struct FSlot
+    {
+        FVMCFrameSnapshot Frame;
+        double DueSeconds = 0.0;
+    };
+
+    double ScheduleFrame(const FVMCFrameSnapshot& Frame); // writer: playout time for a new frame
+
+    FOnPlayout OnPlayout;
+    const double TargetDelay;
+    const double MaxDelay;
+    const bool bAdaptive;
+
+    FSlot Slots[Capacity];
+    std::atomic<uint32> Head{ 0 }; // next slot to play (reader)
+    std::atomic<uint32> Tail{ 0 }; // next slot to fill (writer)
+
+    // Writer-side clock state
+    double LastArrival = -1.0;
+    double LastMedia = 0.0;
+    double LastTransit = 0.0;
+    double LastDue = 0.0;
+    double Interval = 1.0 / 60.0; // smoothed sender frame interval
+    double Jitter = 0.0;
+    double Delay = 0.0;
+
+    FEvent* WakeEvent = nullptr; // playout thread's, set on Register
+
+    FVMCJitterStats Stats;
+};
+
+/**
+ * One playout thread per source, serving the jitter buffers of all its subjects.
+ * Sleeps until the earliest due frame or until a writer publishes.
+ */
+class FVMCPlayoutThread : public FRunnable
+{
+public:
+    virtual ~FVMCPlayoutThread() override;
+
+    bool Start(const FString& ThreadName);
+
+    // Stops and joins (blocking, safe to call twice). Buffers must outlive the thread.
+    void Shutdown();
+
+    // Adds a buffer to the playout set (any thread)
+    void Register(FVMCJitterBuffer* Buffer);
+
+    // FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    FCriticalSection BuffersLock;   // Register vs. the playout loop; never held while pushing
+    TArray<FVMCJitterBuffer*> Buffers;
+
+    FRunnableThread* Thread = nullptr;
+    FEvent* WakeEvent = nullptr;
+    std::atomic<bool> bStopping{ false };
+};
@@ -3,6 +3,8 @@
 
 #if WITH_EDITOR
 #include "Animation/Skeleton.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/AssetRegistryTagsContext.h"
 #endif
 
 #if WITH_EDITOR
@@ -51,6 +53,112 @@ void UVMCLiveLinkMappingAsset::CaptureSignatureFrom(USkeletalMesh* Mesh)
 	Modify();
 }
 
+// ---------------- Registry tags ----------------
+// Bump when the encoding below changes; assets with another version are loaded and inspected
+static const TCHAR* DetectionTagsVersion = TEXT("1");
+static const FName DetectVersionTag(TEXT("VMCDetectVersion"));
+static const FName SignaturesTag(TEXT("VMCSkeletonSignatures"));
+static const FName ExampleMeshesTag(TEXT("VMCExampleMeshes"));
+static const FName FingerprintTag(TEXT("VMCBoneFingerprint"));
+
+// Fixed-width hex, no separators: 8 characters per value
+static FString EncodeHashes(const TArray<uint32>& Values)
+{
+	FString Out;
+	Out.Reserve(Values.Num() * 8);
+	for (uint32 V : Values)
+	{
+		Out.Appendf(TEXT("%08x"), V);
+	}
+	return Out;
+}
+
+static void DecodeHashes(const FString& Text, TArray<uint32>& Out)
+{
+	Out.Reset(Text.Len() / 8);
+	TCHAR Digits[9] = {};
+	for (int32 i = 0; i + 8 <= Text.Len(); i += 8)
+	{
+		FMemory::Memcpy(Digits, *Text + i, 8 * sizeof(TCHAR));
+		Out.Add(static_cast<uint32>(FCString::Strtoui64(Digits, nullptr, 16)));
+	}
+}
+
+uint32 UVMCLiveLinkMappingAsset::HashNormalizedName(const FName Name)
+{
+	return GetTypeHash(NormalizeBoneName(Name.ToString()));
+}
+
+void UVMCLiveLinkMappingAsset::GetDetectionData(TArray<uint32>& OutSignatures, TArray<FSoftObjectPath>& OutExampleMeshes, TArray<uint32>& OutFingerprint) const
+{
+	OutSignatures = SkeletonSignatures;
+
+	OutExampleMeshes.Reset(ExampleReferenceMeshes.Num());
+	for (const TSoftObjectPtr<USkeletalMesh>& Soft : ExampleReferenceMeshes)
+	{
+		if (!Soft.IsNull())
+		{
+			OutExampleMeshes.Add(Soft.ToSoftObjectPath());
+		}
+	}
+
+	OutFingerprint.Reset(BoneNameMap.Num());
+	for (const TPair<FName, FName>& KV : BoneNameMap)
+	{
+		OutFingerprint.Add(HashNormalizedName(KV.Value));
+	}
+	OutFingerprint.Sort();
+}
+
+bool UVMCLiveLinkMappingAsset::ReadDetectionTags(const FAssetData& AssetData, TArray<uint32>& OutSignatures, TArray<FSoftObjectPath>& OutExampleMeshes, TArray<uint32>& OutFingerprint)
+{
+	FString Value;
+	if (!AssetData.GetTagValue(DetectVersionTag, Value) || Value != DetectionTagsVersion)
+	{
+		return false;
+	}
+
+	Value.Reset();
+	AssetData.GetTagValue(SignaturesTag, Value);
+	DecodeHashes(Value, OutSignatures);
+
+	Value.Reset();
+	AssetData.GetTagValue(FingerprintTag, Value);
+	DecodeHashes(Value, OutFingerprint);
+
+	Value.Reset();
+	AssetData.GetTagValue(ExampleMeshesTag, Value);
+	TArray<FString> Paths;
+	Value.ParseIntoArray(Paths, TEXT(";"));
+	OutExampleMeshes.Reset(Paths.Num());
+	for (const FString& Path : Paths)
+	{
+		OutExampleMeshes.Emplace(Path);
+	}
+	return true;
+}
+
+void UVMCLiveLinkMappingAsset::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	Super::GetAssetRegistryTags(Context);
+
+	TArray<uint32> Signatures, Fingerprint;
+	TArray<FSoftObjectPath> ExampleMeshes;
+	GetDetectionData(Signatures, ExampleMeshes, Fingerprint);
+
+	FString MeshPaths;
+	for (const FSoftObjectPath& Path : ExampleMeshes)
+	{
+		if (!MeshPaths.IsEmpty()) MeshPaths += TEXT(";");
+		MeshPaths += Path.ToString();
+	}
+
+	Context.AddTag(FAssetRegistryTag(DetectVersionTag, DetectionTagsVersion, FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag(SignaturesTag, EncodeHashes(Signatures), FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag(ExampleMeshesTag, MeshPaths, FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag(FingerprintTag, EncodeHashes(Fingerprint), FAssetRegistryTag::TT_Hidden));
+}
+
 bool UVMCLiveLinkMappingAsset::MatchesMesh(USkeletalMesh* Mesh) const
 {
 	if (!Mesh) return false;
@@ -1,16 +1,23 @@
 // Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
 #include "Modules/ModuleManager.h"
 #include "VMCLog.h"
+#include "VMCSettingsVersion.h"
 
 class FVMCLiveLinkModule : public IModuleInterface
 {
 public:
     virtual void StartupModule() override
     {
+#if WITH_EDITOR
+        FVMCSettingsVersion::RegisterEditHooks();
+#endif
         UE_LOG(LogVMCLiveLink, Log, TEXT("VMCLiveLink runtime module started"));
     }
     virtual void ShutdownModule() override
     {
+#if WITH_EDITOR
+        FVMCSettingsVersion::UnregisterEditHooks();
+#endif
         UE_LOG(LogVMCLiveLink, Log, TEXT("VMCLiveLink runtime module shutdown"));
     }
 };
@@ -1,5 +1,7 @@
 // Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
 #include "VMCLiveLinkRemapper.h"
+#include "VMCSettingsVersion.h"
+#include "VMCCurveProgram.h"
 
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
@@ -31,18 +33,228 @@ static void GetBoneNames(TSoftObjectPtr<USkeletalMesh> Mesh, TArray<FName>& Out)
 	}
 }
 
+// ---------------- Worker ----------------
+
+void FVMCLiveLinkRemapperWorker::Publish(TSharedPtr<const FVMCRemapperConfig, ESPMode::ThreadSafe> Config)
+{
+	TSharedPtr<FVMCRemapperSnapshot, ESPMode::ThreadSafe> Next = MakeShared<FVMCRemapperSnapshot, ESPMode::ThreadSafe>();
+	Next->Config = MoveTemp(Config);
+	if (const FSnapshotPtr S = Acquire())
+	{
+		// Program is dropped (rules may have changed); what the sender sent is still known
+		Next->StaticNamesHash = S->StaticNamesHash;
+		Next->StaticNumSentNames = S->StaticNumSentNames;
+	}
+	Swap(Next, nullptr, false);
+}
+
+void FVMCLiveLinkRemapperWorker::Swap(FSnapshotPtr Next, const FVMCRemapperSnapshot* Base, bool bExact)
+{
+	FScopeLock Lock(&WriterLock);
+	if (Base && Current.IsValid() && (bExact ? Current.Get() != Base : Current->Config != Base->Config))
+	{
+		return;   // another writer won the race (a publish's static refresh recompiles against its config)
+	}
+
+	{
+		FWriteScopeLock Write(CurrentLock);
+		::Swap(Current, Next);
+	}
+	// Next now holds the replaced snapshot; freed here unless a remap still pins it
+}
+
+// Resolves every incoming name through the map once; the result is reused while the incoming
+// list keeps the same hash
+static FVMCNameRemapTablePtr CompileNameTable(const TArray<FName>& Source, uint32 SourceHash, const TMap<FName, FName>& Map)
+{
+	TSharedPtr<FVMCNameRemapTable, ESPMode::ThreadSafe> Table = MakeShared<FVMCNameRemapTable, ESPMode::ThreadSafe>();
+	Table->SourceHash = SourceHash;
+	Table->NumSource = Source.Num();
+	Table->SourceNames = Source;
+	Table->SourceToTarget.SetNumUninitialized(Source.Num());
+
+	TMap<FName, int32> TargetIndex;
+	TargetIndex.Reserve(Source.Num());
+	for (int32 i = 0; i < Source.Num(); ++i)
+	{
+		const FName* Mapped = Map.Find(Source[i]);
+		const FName Target = Mapped ? *Mapped : Source[i];
+		int32& Index = TargetIndex.FindOrAdd(Target, INDEX_NONE);
+		if (Index == INDEX_NONE)
+		{
+			Index = Table->TargetNames.Add(Target);
+		}
+		Table->SourceToTarget[i] = Index;
+	}
+	return Table;
+}
+
+// Remapped names by gather through a compiled table
+static void GatherNames(const FVMCNameRemapTable& Table, TArray<FName>& Out)
+{
+	Out.SetNumUninitialized(Table.NumSource);
+	const FName* Targets = Table.TargetNames.GetData();
+	const int32* Index = Table.SourceToTarget.GetData();
+	for (int32 i = 0; i < Table.NumSource; ++i)
+	{
+		Out[i] = Targets[Index[i]];
+	}
+}
+
+FVMCNameRemapTablePtr FVMCLiveLinkRemapperWorker::GetBoneRemapTable() const
+{
+	const FSnapshotPtr S = Acquire();
+	return S ? S->BoneTable : FVMCNameRemapTablePtr();
+}
+
+void FVMCLiveLinkRemapperWorker::RemapStaticData(FLiveLinkStaticDataStruct& InOutStaticData)
+{
+	if (!InOutStaticData.IsValid() ||
+		!InOutStaticData.GetStruct()->IsChildOf<FLiveLinkSkeletonStaticData>()) return;
+
+	const FSnapshotPtr S = Acquire();
+	if (!S) return;
+	const FVMCRemapperConfig& Config = *S->Config;
+
+	auto& Skel = *InOutStaticData.Cast<FLiveLinkSkeletonStaticData>();
+	FLiveLinkBaseStaticData& Base = static_cast<FLiveLinkBaseStaticData&>(Skel);   // curves live here in 5.6
+
+	// Static data of the shape seen last time (reconnects, re-pushes) reuses the compiled tables
+	const TArray<FName>& InBones = Skel.GetBoneNames();
+	const uint32 BoneHash = FVMCCurveProgram::HashNames(InBones);
+	const uint32 CurveHash = FVMCCurveProgram::HashNames(Base.PropertyNames);
+	const bool bSameBones = S->BoneTable.IsValid() && S->BoneTable->Matches(BoneHash, InBones);
+	const bool bSameCurves = S->CurveTable.IsValid() && S->CurveTable->Matches(CurveHash, Base.PropertyNames);
+	const FVMCNameRemapTablePtr BoneTable = bSameBones ? S->BoneTable : CompileNameTable(InBones, BoneHash, Config.BoneNameMap);
+	const FVMCNameRemapTablePtr CurveTable = bSameCurves ? S->CurveTable : CompileNameTable(Base.PropertyNames, CurveHash, Config.CurveNameMap);
+
+	TArray<FName> Remapped;
+	GatherNames(*BoneTable, Remapped);
+	Skel.SetBoneNames(Remapped);
+	GatherNames(*CurveTable, Base.PropertyNames);
+
+	// Curve rules against the final names (mirror targets the sender lacks are added as
+	// properties). The static data is moved into the subject afterwards, so the first frame
+	// only binds the program to where its names live.
+	const int32 NumSent = Base.PropertyNames.Num();
+	FVMCCurveProgram::AddMirrorOutputs(Config.CurveRules, Base.PropertyNames);
+	if (bSameBones && bSameCurves && S->Program.IsValid() && S->StaticNumSentNames == NumSent
+		&& S->Program->NumNames == Base.PropertyNames.Num())
+	{
+		return;   // nothing new to compile or publish
+	}
+
+	TSharedPtr<FVMCRemapperSnapshot, ESPMode::ThreadSafe> Next = MakeShared<FVMCRemapperSnapshot, ESPMode::ThreadSafe>();
+	Next->Config = S->Config;
+	Next->BoneTable = BoneTable;
+	Next->CurveTable = CurveTable;
+	Next->Program = FVMCCurveProgram::Compile(Config.CurveRules, Base.PropertyNames, NumSent);
+	Next->StaticNamesHash = Next->Program->NamesHash;
+	Next->StaticNumSentNames = NumSent;
+	Swap(Next, S.Get(), false);
+}
+
+FVMCLiveLinkRemapperWorker::FProgramPtr FVMCLiveLinkRemapperWorker::GetCurveProgram(const FVMCRemapperSnapshot& S, const TArray<FName>& Names)
+{
+	const FVMCCurveProgram* Program = S.Program.Get();
+	if (Program && Program->BoundNames == Names.GetData() && Program->NumNames == Names.Num())
+	{
+		return S.Program;
+	}
+
+	// New static data instance: same names → rebind the compiled program, else compile again
+	const uint32 NamesHash = FVMCCurveProgram::HashNames(Names);
+	TSharedPtr<FVMCCurveProgram, ESPMode::ThreadSafe> Bound;
+	if (Program && Program->NamesHash == NamesHash && Program->NumNames == Names.Num())
+	{
+		Bound = MakeShared<FVMCCurveProgram, ESPMode::ThreadSafe>(*Program);
+	}
+	else
+	{
+		Bound = FVMCCurveProgram::Compile(S.Config->CurveRules, Names, NamesHash == S.StaticNamesHash ? S.StaticNumSentNames : Names.Num());
+	}
+	Bound->BoundNames = Names.GetData();
+
+	TSharedPtr<FVMCRemapperSnapshot, ESPMode::ThreadSafe> Next = MakeShared<FVMCRemapperSnapshot, ESPMode::ThreadSafe>(S);
+	Next->Program = Bound;
+	Swap(Next, &S, true);   // a static remap that landed meanwhile wins
+	return Bound;
+}
+
+void FVMCLiveLinkRemapperWorker::RemapFrameData(const FLiveLinkStaticDataStruct& InStatic, FLiveLinkFrameDataStruct& InOutFrameData)
+{
+	if (!InStatic.IsValid() || !InOutFrameData.IsValid()) return;
+	if (!InStatic.GetStruct()->IsChildOf<FLiveLinkSkeletonStaticData>() ||
+		!InOutFrameData.GetStruct()->IsChildOf<FLiveLinkAnimationFrameData>()) return;
+
+	const FSnapshotPtr S = Acquire();
+	if (!S) return;
+
+	const FLiveLinkBaseStaticData& Base = *InStatic.Cast<FLiveLinkBaseStaticData>();
+	const FProgramPtr Program = GetCurveProgram(*S, Base.PropertyNames);
+	if (Program->IsEmpty())
+	{
+		return;
+	}
+
+	auto& Anim = *InOutFrameData.Cast<FLiveLinkAnimationFrameData>();
+	TArray<float>& Values = Anim.PropertyValues;
+
+	// Properties added by mirror rules are not in the sender's frame yet
+	if (Values.Num() < Base.PropertyNames.Num())
+	{
+		Values.SetNumZeroed(Base.PropertyNames.Num());
+	}
+	Program->Execute(Values);
+}
+
 // Qualify the return type to avoid “assumed int / different basic type”.
 ULiveLinkSubjectRemapper::FWorkerSharedPtr UVMCLiveLinkRemapper::CreateWorker()
 {
 	Worker = MakeShared<FVMCLiveLinkRemapperWorker>();
-	Worker->BoneNameMap = BoneNameMap;     // base class map
-	Worker->CurveNameMap = CurveNameMap;    // our curve map
-	Worker->bEnableMetaHumanCurveNormalizer = bEnableMetaHumanCurveNormalizer;
-	Worker->JoyToSmileStrength = JoyToSmileStrength;
-	Worker->BlinkMirrorStrength = BlinkMirrorStrength;
+	Worker->Publish(BuildWorkerConfig());
 	return Worker;
 }
 
+// Snapshot of the maps and rules for the worker. The MetaHuman normalizer is expressed as
+// curve rules too, ahead of the user's.
+TSharedPtr<const FVMCRemapperConfig, ESPMode::ThreadSafe> UVMCLiveLinkRemapper::BuildWorkerConfig() const
+{
+	TSharedPtr<FVMCRemapperConfig, ESPMode::ThreadSafe> Config = MakeShared<FVMCRemapperConfig, ESPMode::ThreadSafe>();
+	Config->BoneNameMap = BoneNameMap;     // base class map
+	Config->CurveNameMap = CurveNameMap;   // our curve map
+
+	if (bEnableMetaHumanCurveNormalizer)
+	{
+		AppendNormalizerRules(JoyToSmileStrength, BlinkMirrorStrength, Config->CurveRules);
+	}
+	Config->CurveRules.Append(CurveRules);
+	return Config;
+}
+
+void UVMCLiveLinkRemapper::AppendNormalizerRules(float JoyToSmileStrength, float BlinkMirrorStrength, TArray<FVMCCurveRule>& Out)
+{
+	auto Add = [&Out](EVMCCurveOp Op, const TCHAR* In, const TCHAR* Output, float Scale)
+		{
+			FVMCCurveRule& R = Out.AddDefaulted_GetRef();
+			R.Op = Op;
+			R.Inputs.Add(FName(In));
+			R.Output = FName(Output);
+			R.Scale = Scale;
+		};
+
+	// Blink mirroring (single-sided senders); never adds curves the sender lacks, as before
+	Add(EVMCCurveOp::Mirror, TEXT("eyeBlinkLeft"), TEXT("eyeBlinkRight"), BlinkMirrorStrength);
+	Add(EVMCCurveOp::Mirror, TEXT("eyeBlinkRight"), TEXT("eyeBlinkLeft"), BlinkMirrorStrength);
+
+	// Smile spreading
+	Add(EVMCCurveOp::Scale, TEXT("mouthSmileLeft"), TEXT("mouthSmileLeft"), JoyToSmileStrength);
+	Add(EVMCCurveOp::Copy, TEXT("mouthSmileLeft"), TEXT("mouthSmileRight"), 1.f);
+
+	// Funnel→pucker blend
+	Add(EVMCCurveOp::Scale, TEXT("mouthFunnel"), TEXT("mouthPucker"), 0.5f);
+}
+
 void UVMCLiveLinkRemapper::Initialize(const FLiveLinkSubjectKey& InSubjectKey)
 {
 	CachedKey = InSubjectKey;
@@ -81,13 +293,11 @@ void UVMCLiveLinkRemapper::RequestStaticDataRefresh()
 
 void UVMCLiveLinkRemapper::SyncWorker() const
 {
-	if (!Worker.IsValid()) return;
-	Worker->BoneNameMap = BoneNameMap;
-	Worker->CurveNameMap = CurveNameMap;
+	// Sources cache the maps and reference skeleton; tell them to re-read
+	FVMCSettingsVersion::Bump();
 
-	Worker->bEnableMetaHumanCurveNormalizer = bEnableMetaHumanCurveNormalizer;
-	Worker->JoyToSmileStrength = JoyToSmileStrength;
-	Worker->BlinkMirrorStrength = BlinkMirrorStrength;
+	if (!Worker.IsValid()) return;
+	Worker->Publish(BuildWorkerConfig());   // swapped in whole; remaps in flight keep the old one
 }
 
 void UVMCLiveLinkRemapper::DetectAndSeedFromSubject()
@@ -426,6 +636,7 @@ void UVMCLiveLinkRemapper::ApplyMappingAsset(UVMCLiveLinkMappingAsset* Asset, bo
 	// Copy maps
 	BoneNameMap = Asset->BoneNameMap;
 	CurveNameMap = Asset->CurveNameMap;
+	CurveRules = Asset->CurveRules;
 
 	if (bAlsoCaptureSignature)
 	{
@@ -455,63 +666,80 @@ bool UVMCLiveLinkRemapper::AutoDetectAndApplyMapping()
 	TArray<FAssetData> Assets;
 	ARM.GetRegistry().GetAssetsByClass(UVMCLiveLinkMappingAsset::StaticClass()->GetClassPathName(), Assets, /*bSearchSubClasses*/ true);
 
-	// Compute signature once
-	const uint32 Sig = UVMCLiveLinkMappingAsset::ComputeSignature(Ref);
-
-	// 1) Prefer signature match (load asset and check, since FAssetTagValueRef doesn't expose GetArrayValue)
+	// Detection data from registry tags; only assets saved before the tags existed are loaded here
+	struct FCandidate
+	{
+		const FAssetData* Data = nullptr;
+		TArray<uint32> Signatures;
+		TArray<FSoftObjectPath> ExampleMeshes;
+		TArray<uint32> Fingerprint;   // sorted normalized-name hashes of the mapped bones
+	};
+	TArray<FCandidate> Candidates;
+	Candidates.Reserve(Assets.Num());
 	for (const FAssetData& AD : Assets)
 	{
-		UVMCLiveLinkMappingAsset* M = Cast<UVMCLiveLinkMappingAsset>(AD.GetAsset());
-		if (!M) continue;
+		FCandidate& C = Candidates.AddDefaulted_GetRef();
+		C.Data = &AD;
+		if (!UVMCLiveLinkMappingAsset::ReadDetectionTags(AD, C.Signatures, C.ExampleMeshes, C.Fingerprint))
+		{
+			if (const UVMCLiveLinkMappingAsset* M = Cast<UVMCLiveLinkMappingAsset>(AD.GetAsset()))
+			{
+				M->GetDetectionData(C.Signatures, C.ExampleMeshes, C.Fingerprint);
+			}
+		}
+	}
+
+	auto ApplyCandidate = [this](const FCandidate& C)
+	{
+		UVMCLiveLinkMappingAsset* M = Cast<UVMCLiveLinkMappingAsset>(C.Data->GetAsset());
+		if (!M) return false;
+		ApplyMappingAsset(M, /*bAlsoCaptureSignature=*/false);
+		return true;
+	};
 
-		if (M->SkeletonSignatures.Contains(Sig) || M->MatchesMesh(Ref))
+	// 1) Prefer a signature match or an asset listing this mesh as an example
+	const uint32 Sig = UVMCLiveLinkMappingAsset::ComputeSignature(Ref);
+	const FSoftObjectPath RefPath(Ref);
+	for (const FCandidate& C : Candidates)
+	{
+		if ((Sig != 0u && C.Signatures.Contains(Sig)) || C.ExampleMeshes.Contains(RefPath))
 		{
-			ApplyMappingAsset(M, /*bAlsoCaptureSignature=*/false);
-			return true;
+			if (ApplyCandidate(C)) return true;
 		}
 	}
 
 	// 2) Fallback: best-effort heuristic — choose the one with the largest intersection of normalized bone names
 	int32 BestScore = -1;
-	UVMCLiveLinkMappingAsset* Best = nullptr;
+	const FCandidate* Best = nullptr;
 
 	// Build normalized set from ref
-	TSet<FString> RefNorm;
+	TSet<uint32> RefNorm;
 	{
 		const FReferenceSkeleton& RS = Ref->GetRefSkeleton();
+		RefNorm.Reserve(RS.GetNum());
 		for (int32 i = 0; i < RS.GetNum(); ++i)
 		{
-			FString S = RS.GetBoneName(i).ToString().ToLower();
-			S.ReplaceInline(TEXT("_"), TEXT(""));
-			S.ReplaceInline(TEXT("-"), TEXT(""));
-			RefNorm.Add(MoveTemp(S));
+			RefNorm.Add(UVMCLiveLinkMappingAsset::HashNormalizedName(RS.GetBoneName(i)));
 		}
 	}
 
-	for (const FAssetData& AD : Assets)
+	for (const FCandidate& C : Candidates)
 	{
-		UVMCLiveLinkMappingAsset* M = Cast<UVMCLiveLinkMappingAsset>(AD.GetAsset());
-		if (!M) continue;
-
 		int32 Score = 0;
-		for (const TPair<FName,FName>& KV : M->BoneNameMap)
+		for (uint32 H : C.Fingerprint)
 		{
-			FString S = KV.Value.ToString().ToLower();
-			S.ReplaceInline(TEXT("_"), TEXT(""));
-			S.ReplaceInline(TEXT("-"), TEXT(""));
-			if (RefNorm.Contains(S)) ++Score;
+			if (RefNorm.Contains(H)) ++Score;
 		}
 		if (Score > BestScore)
 		{
 			BestScore = Score;
-			Best = M;
+			Best = &C;
 		}
 	}
 
 	if (Best && BestScore > 0)
 	{
-		ApplyMappingAsset(Best, /*bAlsoCaptureSignature=*/false);
-		return true;
+		return ApplyCandidate(*Best);
 	}
 #endif
 
@@ -525,6 +753,7 @@ void UVMCLiveLinkRemapper::SaveCurrentMappingTo(UVMCLiveLinkMappingAsset* Asset,
 	Asset->Modify();
 	Asset->BoneNameMap = BoneNameMap;
 	Asset->CurveNameMap = CurveNameMap;
+	Asset->CurveRules = CurveRules;
 
 #if WITH_EDITOR
 	if (bCaptureSignatureFromReference)
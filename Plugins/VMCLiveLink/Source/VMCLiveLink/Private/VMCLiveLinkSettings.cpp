@@ -13,3 +13,13 @@ UVMCLiveLinkSettings::UVMCLiveLinkSettings()
     DefaultRemapperClass = UVMCLiveLinkRemapper::StaticClass();
     // DefaultReferenceSkeleton left unset; project can configure it.
 }
+
+void UVMCLiveLinkSettings::SetDefaultRemapperClass(TSoftClassPtr<ULiveLinkSubjectRemapper> InClass)
+{
+    GetMutableDefault<UVMCLiveLinkSettings>()->DefaultRemapperClass = InClass;
+}
+
+void UVMCLiveLinkSettings::SetDefaultReferenceSkeleton(TSoftObjectPtr<USkeletalMesh> InMesh)
+{
+    GetMutableDefault<UVMCLiveLinkSettings>()->DefaultReferenceSkeleton = InMesh;
+}
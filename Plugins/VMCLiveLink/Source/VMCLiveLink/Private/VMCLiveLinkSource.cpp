@@ -7,51 +7,46 @@
 #include "LiveLinkTypes.h"
 #include "Roles/LiveLinkAnimationRole.h"
 #include "Roles/LiveLinkAnimationTypes.h"
+#include "Roles/LiveLinkTransformRole.h"
+#include "Roles/LiveLinkTransformTypes.h"
+#include "Roles/LiveLinkCameraRole.h"
+#include "Roles/LiveLinkCameraTypes.h"
 
 #include "VMCLiveLinkSettings.h"
+#include "VMCLiveLinkSourceSettings.h"
 #include "LiveLinkSubjectSettings.h"
 #include "LiveLinkSubjectRemapper.h"
 #include "VMCLiveLinkRemapper.h"
 #include "Async/Async.h"
-
-// OSC (cpp-only)
-#include "OSCServer.h"
-#include "OSCMessage.h"
-#include "OSCTypes.h"
+#include "Misc/App.h"
+#include "Misc/ScopeExit.h"
+
+// Ingest
+#include "VMCOscDecoder.h"
+#include "VMCAddressRouter.h"
+#include "VMCPerformer.h"
+#include "VMCHumanoidSchema.h"
+#include "VMCSettingsVersion.h"
+#include "VMCReceiverRegistry.h"
+#include "VMCStats.h"
+#include "Interfaces/IPv4/IPv4Address.h"
 
 // Math
 #include "Math/RotationMatrix.h"
 #include "Engine/SkeletalMesh.h" // for BuildRefOffsetsFromMesh
 
-// ---------------- Utils: OSC argument reading (UE5.6) ----------------
+// ---------------- Utils: OSC argument reading ----------------
 
-static bool ReadStringFloat7(const FOSCMessage& Msg, FString& OutName,
-    float& px, float& py, float& pz,
-    float& qx, float& qy, float& qz, float& qw)
+// Reads N numeric args starting at First (floats; ints are widened)
+static bool ReadFloats(const FVMCOscMessage& Msg, int32 First, int32 N, float* Out)
 {
-    const TArray<UE::OSC::FOSCData>& A = Msg.GetArgumentsChecked();
-    if (A.Num() != 8) return false;
-    OutName = A[0].GetString();
-    px = A[1].GetFloat(); py = A[2].GetFloat(); pz = A[3].GetFloat();
-    qx = A[4].GetFloat(); qy = A[5].GetFloat(); qz = A[6].GetFloat(); qw = A[7].GetFloat();
-    return true;
-}
-
-static bool ReadFloat7(const FOSCMessage& Msg,
-    float& px, float& py, float& pz,
-    float& qx, float& qy, float& qz, float& qw)
-{
-    const TArray<UE::OSC::FOSCData>& A = Msg.GetArgumentsChecked();
-    if (A.Num() != 7) return false;
-    px = A[0].GetFloat();
-    py = A[1].GetFloat();
-    pz = A[2].GetFloat();
-    
-    qx = A[3].GetFloat();
-    qy = A[4].GetFloat();
-    qz = A[5].GetFloat();
-    qw = A[6].GetFloat();
-    
+    if (Msg.NumArgs < First + N) return false;
+    for (int32 i = 0; i < N; ++i)
+    {
+        const FVMCOscArg& A = Msg.Args[First + i];
+        if (!A.IsNumeric()) return false;
+        Out[i] = A.AsFloat();
+    }
     return true;
 }
 
@@ -71,49 +66,158 @@ static FQuat ToUERotation(bool bUnityToUE, float qx, float qy, float qz, float q
     return N;
 }
 
+// Whole-frame Unity → UE conversion of raw bone samples ({px,py,pz,0,qx,qy,qz,qw} per slot), one
+// vector op per component group: axis swap and sign, meters → cm, quaternion normalization, and
+// hemisphere continuity against the slot's previous rotation (so interpolation never takes the
+// long way round). Only slots with a sample are written.
+static void ConvertPoseBatch(const float* Raw, const uint8* Valid, FVector4f* Hemisphere, FTransform* Out, int32 Num,
+    bool bUnityToUE, bool bMetersToCm)
+{
+    const float S = bMetersToCm ? 100.f : 1.f;
+    const VectorRegister4Float PosScale = bUnityToUE ? MakeVectorRegisterFloat(-S, S, S, 0.f) : MakeVectorRegisterFloat(S, S, S, 0.f);
+    const VectorRegister4Float RotSign = bUnityToUE ? MakeVectorRegisterFloat(-1.f, 1.f, 1.f, 1.f) : GlobalVectorConstants::FloatOne;
+
+    alignas(16) float Pos4[4];
+    alignas(16) float Rot4[4];
+    for (int32 i = 0; i < Num; ++i)
+    {
+        if (!Valid[i])
+        {
+            continue;
+        }
+
+        VectorRegister4Float Pos = VectorLoad(Raw + i * FVMCPerformer::RawPoseStride);
+        VectorRegister4Float Rot = VectorLoad(Raw + i * FVMCPerformer::RawPoseStride + 4);
+        if (bUnityToUE)
+        {
+            // (x, y, z) → (-x, z, y)
+            Pos = VectorSwizzle(Pos, 0, 2, 1, 3);
+            Rot = VectorSwizzle(Rot, 0, 2, 1, 3);
+        }
+        Pos = VectorMultiply(Pos, PosScale);
+        Rot = VectorNormalizeSafe(VectorMultiply(Rot, RotSign), GlobalVectorConstants::Float0001);
+
+        const VectorRegister4Float Prev = VectorLoad(&Hemisphere[i].X);
+        const VectorRegister4Float Flip = VectorCompareLT(VectorDot4(Rot, Prev), GlobalVectorConstants::FloatZero);
+        Rot = VectorSelect(Flip, VectorNegate(Rot), Rot);
+        VectorStore(Rot, &Hemisphere[i].X);
+
+        VectorStoreAligned(Pos, Pos4);
+        VectorStoreAligned(Rot, Rot4);
+        Out[i].SetComponents(FQuat(Rot4[0], Rot4[1], Rot4[2], Rot4[3]), FVector(Pos4[0], Pos4[1], Pos4[2]), FVector::OneVector);
+    }
+}
+
+// ---------------- Utils: idle deadband ----------------
+
+// True when every bone is within the tolerances (FTransform compares are vectorized)
+static bool PoseWithinDeadband(const FTransform* A, const FTransform* B, int32 Num, float RotTol, float PosTol)
+{
+    for (int32 i = 0; i < Num; ++i)
+    {
+        if (!FTransform::AreRotationsEqual(A[i], B[i], RotTol) || !FTransform::AreTranslationsEqual(A[i], B[i], PosTol))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// True when every curve is within Tol; four lanes at a time
+static bool CurvesWithinDeadband(const float* A, const float* B, int32 Num, float Tol)
+{
+    const VectorRegister4Float T = VectorSetFloat1(Tol);
+    int32 i = 0;
+    for (; i + 4 <= Num; i += 4)
+    {
+        if (VectorAnyGreaterThan(VectorAbs(VectorSubtract(VectorLoad(A + i), VectorLoad(B + i))), T))
+        {
+            return false;
+        }
+    }
+    for (; i < Num; ++i)
+    {
+        if (FMath::Abs(A[i] - B[i]) > Tol)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 // ---------------- Ctors & status ----------------
 
 FVMCLiveLinkSource::FVMCLiveLinkSource(const FString& InSourceName)
-    : SourceName(InSourceName), ListenPort(39539), bUnityToUE(true), bMetersToCm(true), YawOffsetDeg(0.f)
+    : FVMCLiveLinkSource(InSourceName, 39539, true, true, 0.f, TEXT("VMC_Subject"), FVMCLiveLinkSourceOptions())
 {
 }
 
 FVMCLiveLinkSource::FVMCLiveLinkSource(const FString& InSourceName, int32 InPort)
-    : SourceName(InSourceName), ListenPort(InPort), bUnityToUE(true), bMetersToCm(true), YawOffsetDeg(0.f)
+    : FVMCLiveLinkSource(InSourceName, InPort, true, true, 0.f, TEXT("VMC_Subject"), FVMCLiveLinkSourceOptions())
 {
 }
 
 FVMCLiveLinkSource::FVMCLiveLinkSource(const FString& InSourceName, int32 InPort, bool bInUnityToUE, bool bInMetersToCm, float InYawDeg)
-    : SourceName(InSourceName), ListenPort(InPort), bUnityToUE(bInUnityToUE), bMetersToCm(bInMetersToCm), YawOffsetDeg(InYawDeg)
+    : FVMCLiveLinkSource(InSourceName, InPort, bInUnityToUE, bInMetersToCm, InYawDeg, TEXT("VMC_Subject"), FVMCLiveLinkSourceOptions())
 {
 }
 
 FVMCLiveLinkSource::FVMCLiveLinkSource(const FString& InSourceName, int32 InPort, bool bInUnityToUE, bool bInMetersToCm, float InYawDeg, FString InSubject)
-    : SourceName(InSourceName), ListenPort(InPort), bUnityToUE(bInUnityToUE), bMetersToCm(bInMetersToCm), YawOffsetDeg(InYawDeg), SubjectName(InSubject)
+    : FVMCLiveLinkSource(InSourceName, InPort, bInUnityToUE, bInMetersToCm, InYawDeg, InSubject, FVMCLiveLinkSourceOptions())
+{
+}
 
+FVMCLiveLinkSource::FVMCLiveLinkSource(const FString& InSourceName, int32 InPort, bool bInUnityToUE, bool bInMetersToCm, float InYawDeg, FString InSubject, const FVMCLiveLinkSourceOptions& InOptions)
+    : SourceName(InSourceName), ListenPort(InPort), bUnityToUE(bInUnityToUE), bMetersToCm(bInMetersToCm), YawOffsetDeg(InYawDeg), Options(InOptions), SubjectName(InSubject)
 {
 }
 
+FVMCLiveLinkSource::~FVMCLiveLinkSource()
+{
+    // Receiver/playout/tick callbacks capture 'this'; make sure they can no longer run
+    StopReceiver();
+    StopPlayout();
+    StopOutput();
+}
+
 void FVMCLiveLinkSource::ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid)
 {
     Client = InClient;
     SourceGuid = InSourceGuid;
-    bIsValid = StartOSC();
-    AsyncTask(ENamedThreads::GameThread, [this]()
+
+    if (Options.JitterTargetMs > 0.f)
     {
-        EnsureSubjectSettingsWithDefaults();
-    });
-    // Warm caches and republish static once with mapped names
-    RefreshStaticMapsFromSettings();
-    bForceStaticNext = true;
+        StartPlayout();
+    }
+    const bool bTickPush = !PlayoutThread.IsValid() && Options.OutputPolicy == EVMCOutputPolicy::PerEngineTick;
+    if (bTickPush || Options.ConcealMaxMs > 0.f)
+    {
+        OutputTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FVMCLiveLinkSource::OnEngineTick));
+    }
+
+    // Single-subject sources create their performer up front (warm caches, settings, static
+    // once with mapped names) before ingest starts; from here on only the ingest thread touches it.
+    if (Options.DemuxMode == EVMCDemuxMode::None)
+    {
+        FindOrAddPerformer(0, 0);
+    }
+
+    bIsValid = StartReceiver();
 
-    UE_LOG(LogVMCLiveLink, Log, TEXT("VMC source '%s' listening on %d (valid=%d, unity2ue=%d, m_to_cm=%d, yaw=%.1f)"),
-        *SourceName, ListenPort, bIsValid ? 1 : 0, bUnityToUE ? 1 : 0, bMetersToCm ? 1 : 0, YawOffsetDeg);
+    UE_LOG(LogVMCLiveLink, Log, TEXT("VMC source '%s' listening on %d (valid=%d, ingest=%s, multicast=%s, unity2ue=%d, m_to_cm=%d, yaw=%.1f)"),
+        *SourceName, ListenPort, bIsValid ? 1 : 0,
+        Options.IngestMode == EVMCIngestMode::Replay ? TEXT("replay") : Options.IngestMode == EVMCIngestMode::NativeUdp ? TEXT("native") : TEXT("osc"),
+        Options.Multicast.Group.IsEmpty() ? TEXT("off") : *Options.Multicast.Group,
+        bUnityToUE ? 1 : 0, bMetersToCm ? 1 : 0, YawOffsetDeg);
 }
 
 bool FVMCLiveLinkSource::RequestSourceShutdown()
 {
-    StopOSC();
+    StopReceiver();
+    StopPlayout();
+    StopOutput();
+    LogOutputStats();
+    LogConcealStats();
     bIsValid = false;
     Client = nullptr;
     return true;
@@ -121,7 +225,34 @@ bool FVMCLiveLinkSource::RequestSourceShutdown()
 
 FText FVMCLiveLinkSource::GetSourceStatus() const
 {
-    const bool bReady = bIsValid && bStaticSent;
+    int32 NumPerformers = 0;
+    bool bReady = false;
+    bool bAnyAvatar = false;
+    {
+        FScopeLock Lock(&PerformersLock);
+        NumPerformers = Performers.Num();
+        for (const TUniquePtr<FVMCPerformer>& P : Performers)
+        {
+            bReady |= P->bStaticSent.load(std::memory_order_relaxed);
+            bAnyAvatar |= P->SenderLoaded.load(std::memory_order_relaxed) != 0;
+        }
+    }
+
+    if (bIsValid && NumPerformers > 0 && !bAnyAvatar)
+    {
+        return NSLOCTEXT("VMCLiveLink", "Status_NoAvatar", "Sender has no avatar loaded");
+    }
+
+    if (bIsValid && bReady && NumPerformers > 1)
+    {
+        return FText::Format(NSLOCTEXT("VMCLiveLink", "Status_ReceivingPerformers", "Receiving data ({0} performers)"), NumPerformers);
+    }
+
+    bReady = bIsValid && bReady;
+    if (bReady && PacketsPerSecond > 0.f)
+    {
+        return FText::Format(NSLOCTEXT("VMCLiveLink", "Status_ReceivingRate", "Receiving data ({0} pkt/s)"), FText::AsNumber(FMath::RoundToInt(PacketsPerSecond)));
+    }
     return bIsValid
         ? (bReady
             ? NSLOCTEXT("VMCLiveLink", "Status_Receiving", "Receiving data")
@@ -129,309 +260,1164 @@ FText FVMCLiveLinkSource::GetSourceStatus() const
         : NSLOCTEXT("VMCLiveLink", "Status_Stopped", "Stopped");
 }
 
-// ---------------- OSC lifecycle ----------------
+// Adds one performer's counters (push time accumulates in cycles; the caller converts)
+static void AddPerformerStats(const FVMCPerformer& P, FVMCLiveLinkSourceStats& Out, uint64& PushCycles)
+{
+    const FVMCIngestStats& I = P.IngestStats;
+    Out.BadMessages += I.BadMessages.load(std::memory_order_relaxed);
+    Out.UnknownAddresses += I.UnknownAddresses.load(std::memory_order_relaxed);
+
+    const FVMCOutputStats& S = P.OutputStats;
+    Out.Committed += S.Committed.load(std::memory_order_relaxed);
+    Out.Pushed += S.Pushed.load(std::memory_order_relaxed);
+    Out.Coalesced += S.Coalesced.load(std::memory_order_relaxed);
+    Out.Suppressed += S.Suppressed.load(std::memory_order_relaxed);
+    Out.StaticPushes += S.StaticPushes.load(std::memory_order_relaxed);
+    PushCycles += S.PushCycles.load(std::memory_order_relaxed);
+    for (int32 i = 0; i < FVMCLiveLinkSourceStats::NumLatencyBuckets; ++i)
+    {
+        Out.Latency[i] += S.Latency[i].load(std::memory_order_relaxed);
+        Out.ApplyLatency[i] += S.ApplyLatency[i].load(std::memory_order_relaxed);
+    }
+    if (P.JitterBuffer.IsValid())
+    {
+        Out.Dropped += P.JitterBuffer->GetStats().Overflow.load(std::memory_order_relaxed);
+    }
+}
+
+void FVMCLiveLinkSource::GetStats(FVMCLiveLinkSourceStats& Out) const
+{
+    Out = FVMCLiveLinkSourceStats();
+    Out.Datagrams = DatagramsHandled.load(std::memory_order_relaxed);
+    Out.Messages = MessagesHandled.load(std::memory_order_relaxed);
+    Out.Malformed = MalformedDatagrams.load(std::memory_order_relaxed);
+    Out.Rejected = RejectedDatagrams.load(std::memory_order_relaxed);
+    Out.IngestSeconds = FPlatformTime::ToSeconds64(IngestCycles.load(std::memory_order_relaxed));
+
+    uint64 PushCycles = 0;
+    FScopeLock Lock(&PerformersLock);
+    Out.NumPerformers = Performers.Num();
+    for (const TUniquePtr<FVMCPerformer>& P : Performers)
+    {
+        AddPerformerStats(*P, Out, PushCycles);
+    }
+    Out.PushSeconds = FPlatformTime::ToSeconds64(PushCycles);
+}
+
+void FVMCLiveLinkSource::GetSubjectStats(TArray<FVMCLiveLinkSubjectStats>& Out) const
+{
+    Out.Reset();
+
+    FScopeLock Lock(&PerformersLock);
+    for (const TUniquePtr<FVMCPerformer>& P : Performers)
+    {
+        FVMCLiveLinkSubjectStats& S = Out.AddDefaulted_GetRef();
+        S.Subject = P->SubjectName;
+        S.Stats.NumPerformers = 1;
+        S.Stats.Datagrams = P->IngestStats.Datagrams.load(std::memory_order_relaxed);
+        S.Stats.Messages = P->IngestStats.Messages.load(std::memory_order_relaxed);
+
+        uint64 PushCycles = 0;
+        AddPerformerStats(*P, S.Stats, PushCycles);
+        S.Stats.PushSeconds = FPlatformTime::ToSeconds64(PushCycles);
+    }
+}
+
+// ---------------- Live Link panel statistics ----------------
+
+// Totals since start plus rates over Window (the counters accumulated in the last Seconds)
+static void FillStatsView(FVMCLiveLinkStatsView& V, const FVMCLiveLinkSourceStats& Total, const FVMCLiveLinkSourceStats& Window, double Seconds)
+{
+    V.PacketsPerSecond = Seconds > 0.0 ? (float)(Window.Datagrams / Seconds) : 0.f;
+    V.FramesPerSecond = Seconds > 0.0 ? (float)(Window.Pushed / Seconds) : 0.f;
+    V.MessagesPerFrame = Window.Committed > 0 ? (float)((double)Window.Messages / Window.Committed) : 0.f;
+    V.ApplyToPushP50Ms = (float)(Window.ApplyLatencyPercentileUs(0.5) * 0.001);
+    V.ApplyToPushP99Ms = (float)(Window.ApplyLatencyPercentileUs(0.99) * 0.001);
+
+    V.MalformedDatagrams = (int64)Total.Malformed;
+    V.BadMessages = (int64)Total.BadMessages;
+    V.UnknownAddresses = (int64)Total.UnknownAddresses;
+    V.RejectedDatagrams = (int64)Total.Rejected;
+    V.DroppedFrames = (int64)Total.Dropped;
+    V.CoalescedFrames = (int64)Total.Coalesced;
+    V.SuppressedFrames = (int64)Total.Suppressed;
+    V.StaticRepublishes = (int64)Total.StaticPushes;
+}
+
+TSubclassOf<ULiveLinkSourceSettings> FVMCLiveLinkSource::GetSettingsClass() const
+{
+    return UVMCLiveLinkSourceSettings::StaticClass();
+}
+
+void FVMCLiveLinkSource::InitializeSettings(ULiveLinkSourceSettings* Settings)
+{
+    StatsSettings = Cast<UVMCLiveLinkSourceSettings>(Settings);
+}
 
-bool FVMCLiveLinkSource::StartOSC()
+void FVMCLiveLinkSource::Update()
 {
-    if (OscServer.IsValid())
+    const double Now = FPlatformTime::Seconds();
+    if (Now - LastStatsSeconds < 1.0)
+    {
+        return;
+    }
+    const double Seconds = LastStatsSeconds > 0.0 ? Now - LastStatsSeconds : 0.0;
+    LastStatsSeconds = Now;
+
+    CheckSubjectRemappers();
+
+    FVMCLiveLinkSourceStats Total;
+    GetStats(Total);
+    const FVMCLiveLinkSourceStats Window = Total - LastSourceStats;
+    LastSourceStats = Total;
+    PacketsPerSecond = Seconds > 0.0 ? (float)(Window.Datagrams / Seconds) : 0.f;
+
+    UVMCLiveLinkSourceSettings* Settings = StatsSettings.Get();
+    if (!Settings)
+    {
+        return;
+    }
+    FillStatsView(Settings->Source, Total, Window, Seconds);
+    Settings->Source.Subject = SubjectName;
+
+    TArray<FVMCLiveLinkSubjectStats> Subjects;
+    GetSubjectStats(Subjects);
+    TMap<FName, FVMCLiveLinkSourceStats> Previous = MoveTemp(LastSubjectStats);
+    LastSubjectStats.Reset();
+
+    Settings->Subjects.SetNum(Subjects.Num());
+    for (int32 i = 0; i < Subjects.Num(); ++i)
+    {
+        const FVMCLiveLinkSubjectStats& S = Subjects[i];
+        const FVMCLiveLinkSourceStats* Before = Previous.Find(S.Subject);
+        FillStatsView(Settings->Subjects[i], S.Stats, Before ? S.Stats - *Before : S.Stats, Before ? Seconds : 0.0);
+        Settings->Subjects[i].Subject = S.Subject;
+        LastSubjectStats.Add(S.Subject, S.Stats);
+    }
+}
+
+// ---------------- Receive lifecycle ----------------
+
+bool FVMCLiveLinkSource::StartReceiver()
+{
+    if (ReceiverHandle != 0)
         return true;
 
-    OscServer = TStrongObjectPtr<UOSCServer>(NewObject<UOSCServer>());
-    if (!OscServer.IsValid())
+    // The port's socket is shared with every other source on it; each datagram is decoded once
+    ReceiverHandle = FVMCReceiverRegistry::Get().AddListener(ListenPort, Options,
+        [this](const FVMCDecodedPacket& Packet)
+        {
+            OnPacketReceived(Packet);
+        });
+    return ReceiverHandle != 0;
+}
+
+void FVMCLiveLinkSource::StopReceiver()
+{
+    if (ReceiverHandle != 0)
     {
-        UE_LOG(LogVMCLiveLink, Error, TEXT("Failed to create UOSCServer"));
-        return false;
+        FVMCReceiverRegistry::Get().RemoveListener(ListenPort, ReceiverHandle);
+        ReceiverHandle = 0;
     }
+}
 
-    OscServer->OnOscMessageReceivedNative.AddRaw(this, &FVMCLiveLinkSource::OnOscMessageReceived);
+bool FVMCLiveLinkSource::StartPlayout()
+{
+    if (PlayoutThread.IsValid())
+        return true;
 
-    if (!OscServer->SetAddress(TEXT("0.0.0.0"), (uint16)ListenPort))
+    PlayoutThread = MakeUnique<FVMCPlayoutThread>();
+
+    const FString ThreadName = FString::Printf(TEXT("VMCPlayout_%d"), ListenPort);
+    if (!PlayoutThread->Start(ThreadName))
     {
-        UE_LOG(LogVMCLiveLink, Error, TEXT("UOSCServer SetAddress failed for port %d"), ListenPort);
-        OscServer->OnOscMessageReceivedNative.RemoveAll(this);
-        OscServer.Reset();
+        UE_LOG(LogVMCLiveLink, Warning, TEXT("VMC jitter buffer thread failed to start; pushing frames immediately"));
+        PlayoutThread.Reset();
         return false;
     }
+    return true;
+}
 
-    OscServer->Listen();
+void FVMCLiveLinkSource::StopPlayout()
+{
+    if (PlayoutThread.IsValid())
+    {
+        PlayoutThread->Shutdown();
+        PlayoutThread.Reset();
+
+        FScopeLock Lock(&PerformersLock);
+        for (const TUniquePtr<FVMCPerformer>& P : Performers)
+        {
+            if (!P->JitterBuffer.IsValid())
+            {
+                continue;
+            }
+            const FVMCJitterStats& S = P->JitterBuffer->GetStats();
+            UE_LOG(LogVMCLiveLink, Log, TEXT("VMC '%s' playout: pushed=%llu late=%llu early=%llu skipped=%llu overflow=%llu delay=%.1fms jitter=%.1fms"),
+                *P->SubjectName.ToString(), S.Pushed.load(), S.Late.load(), S.Early.load(), S.Skipped.load(), S.Overflow.load(),
+                S.DelayMs.load(), S.JitterMs.load());
+            P->JitterBuffer.Reset();
+        }
+    }
+}
+
+// ---------------- Output decimation ----------------
+
+bool FVMCLiveLinkSource::ShouldPushOnCommit(FVMCPerformer& P)
+{
+    switch (Options.OutputPolicy)
+    {
+    case EVMCOutputPolicy::FixedRate:
+    {
+        if (Options.OutputRateHz <= 0.f)
+        {
+            return true;
+        }
+        const double Interval = 1.0 / Options.OutputRateHz;
+        const double Now = FPlatformTime::Seconds();
+        if (Now < P.NextOutputSeconds)
+        {
+            return false; // stays in the hand-off; the next commit replaces it (coalesced)
+        }
+        // Stay on the output grid; re-anchor after a gap instead of bursting to catch up
+        P.NextOutputSeconds += Interval;
+        if (P.NextOutputSeconds <= Now)
+        {
+            P.NextOutputSeconds = Now + Interval;
+        }
+        return true;
+    }
+    case EVMCOutputPolicy::PerEngineTick:
+        return false; // OnEngineTick pushes
+    default:
+        return true;
+    }
+}
+
+bool FVMCLiveLinkSource::OnEngineTick(float /*DeltaTime*/)
+{
+    // Newest committed frame per performer, once per tick; the game thread is the only pusher here
+    const bool bTickPush = !PlayoutThread.IsValid() && Options.OutputPolicy == EVMCOutputPolicy::PerEngineTick;
+    const double Now = FPlatformTime::Seconds();
+
+    FScopeLock Lock(&PerformersLock);
+    for (const TUniquePtr<FVMCPerformer>& P : Performers)
+    {
+        if (bTickPush)
+        {
+            PushLatestFrame(*P);
+        }
+        if (P->Concealer.IsValid())
+        {
+            ConcealGap(*P, Now);
+        }
+    }
     return true;
 }
 
-void FVMCLiveLinkSource::StopOSC()
+void FVMCLiveLinkSource::StopOutput()
 {
-    if (OscServer.IsValid())
+    if (OutputTickHandle.IsValid())
     {
-        OscServer->OnOscMessageReceivedNative.RemoveAll(this);
-        OscServer->Stop();
-        OscServer.Reset();
+        FTSTicker::GetCoreTicker().RemoveTicker(OutputTickHandle);
+        OutputTickHandle.Reset();
     }
 }
 
-// ---------------- OSC message handler ----------------
+void FVMCLiveLinkSource::LogOutputStats() const
+{
+    const bool bThinned = Options.OutputPolicy != EVMCOutputPolicy::PassThrough && Options.JitterTargetMs <= 0.f;
+    if (!bThinned && !Options.bDeadband)
+    {
+        return;
+    }
+
+    FScopeLock Lock(&PerformersLock);
+    for (const TUniquePtr<FVMCPerformer>& P : Performers)
+    {
+        const FVMCOutputStats& S = P->OutputStats;
+        if (S.Committed.load() == 0)
+        {
+            continue;
+        }
+        UE_LOG(LogVMCLiveLink, Log, TEXT("VMC '%s' output: committed=%llu pushed=%llu coalesced=%llu suppressed=%llu"),
+            *P->SubjectName.ToString(), S.Committed.load(), S.Pushed.load(), S.Coalesced.load(), S.Suppressed.load());
+    }
+}
+
+// ---------------- Packet-loss concealment ----------------
 
-void FVMCLiveLinkSource::OnOscMessageReceived(const FOSCMessage& Msg, const FString& FromIP, uint16 FromPort)
+void FVMCLiveLinkSource::ConcealGap(FVMCPerformer& P, double Now)
 {
-    const FString Addr = Msg.GetAddress().GetFullPath();
+    FScopeLock Lock(&P.PushLock);
+    if (!Client || !P.LastPushedLayout.IsValid() || !P.Concealer->IsInGap(Now))
+    {
+        return;
+    }
 
-    if (Addr == TEXT("/VMC/Ext/Bone/Pos"))
+    FLiveLinkFrameDataStruct Frame(FLiveLinkAnimationFrameData::StaticStruct());
+    auto& Anim = *Frame.Cast<FLiveLinkAnimationFrameData>();
+    if (!P.Concealer->Extrapolate(Now, Anim.Transforms))
     {
-        FString Bone; float px, py, pz, qx, qy, qz, qw;
-        if (!ReadStringFloat7(Msg, Bone, px, py, pz, qx, qy, qz, qw))
-            return;
+        return; // window used up: the last pushed pose holds
+    }
 
-        const FName BoneName(*Bone);
+    // Same layout as the last real frame (no static push); curves hold, time keeps the sender mapping
+    FLiveLinkBaseFrameData& Base = static_cast<FLiveLinkBaseFrameData&>(Anim);
+    Base.WorldTime = FLiveLinkWorldTime(Now + P.LastPushedWorldOffset);
+    Base.PropertyValues = P.LastPushedValues;
 
-        FVector P = ToUEPosition(bUnityToUE, bMetersToCm, px, py, pz);
-        FQuat   Q = ToUERotation(bUnityToUE, qx, qy, qz, qw);
+    if (Options.bDeadband)
+    {
+        FVMCFrameExchange::CopyDense(P.LastPushedTransforms, Anim.Transforms);
+    }
+    P.LastPushSeconds = Now;
 
-        const FTransform Xf(Q, P, FVector(1));
+    Client->PushSubjectFrameData_AnyThread({ SourceGuid, P.SubjectName }, MoveTemp(Frame));
+}
 
-        FScopeLock Lock(&DataGuard);
-        if (!BoneNames.Contains(BoneName))
+void FVMCLiveLinkSource::LogConcealStats() const
+{
+    FScopeLock Lock(&PerformersLock);
+    for (const TUniquePtr<FVMCPerformer>& P : Performers)
+    {
+        if (!P->Concealer.IsValid())
         {
-            // Default: first seen bone becomes root (-1 parent). Others parent to 0 unless explicitly "root".
-            int32 Parent = BoneNames.Num() == 0 ? -1 : 0;
-            if (BoneName == FName("root")) Parent = -1;
-            BoneNames.Add(BoneName);
-            BoneParents.Add(Parent);
-            bStaticSent = false;          // ensure we republish new skeleton
-            bForceStaticNext = true;
+            continue;
         }
-        PendingPose.Add(BoneName, Xf);
+        const FVMCConcealStats& S = P->Concealer->GetStats();
+        UE_LOG(LogVMCLiveLink, Log, TEXT("VMC '%s' concealment: gaps=%llu lost~%llu concealed=%llu longest=%.1fms"),
+            *P->SubjectName.ToString(), S.Gaps.load(), S.LostFrames.load(), S.ConcealedFrames.load(), S.LongestGapMs.load());
     }
-    else if (Addr == TEXT("/VMC/Ext/Root/Pos"))
+}
+
+// ---------------- Performers (demultiplexing) ----------------
+
+uint64 FVMCLiveLinkSource::MakeSenderKey(uint32 FromIp, uint16 FromPort) const
+{
+    switch (Options.DemuxMode)
     {
-        float px, py, pz, qx, qy, qz, qw;
-        if (!ReadFloat7(Msg, px, py, pz, qx, qy, qz, qw))
-            return;
+    case EVMCDemuxMode::SenderEndpoint: return (uint64(FromIp) << 16) | FromPort;
+    case EVMCDemuxMode::SenderAddress:  return uint64(FromIp) << 16;
+    default:                            return 0;
+    }
+}
 
-        FVector PR = ToUEPosition(bUnityToUE, bMetersToCm, px, py, pz);
-        FQuat   QR = ToUERotation(bUnityToUE, qx, qy, qz, qw);
+FName FVMCLiveLinkSource::MakePerformerSubjectName(uint32 FromIp, uint16 FromPort) const
+{
+    if (Options.DemuxMode == EVMCDemuxMode::None)
+    {
+        return SubjectName;
+    }
 
-        // Apply extra yaw offset about UE Z
-        if (!FMath::IsNearlyZero(YawOffsetDeg))
+    // Explicit rules first (port 0 = any port)
+    for (const FVMCPerformerRule& Rule : Options.PerformerRules)
+    {
+        FIPv4Address RuleIp;
+        if (FIPv4Address::Parse(Rule.Address, RuleIp) && RuleIp.Value == FromIp && (Rule.Port == 0 || Rule.Port == FromPort))
         {
-            const FQuat YawDelta(FVector::UpVector, FMath::DegreesToRadians(YawOffsetDeg));
-            QR = YawDelta * QR;
-            PR = YawDelta.RotateVector(PR);
+            return Rule.SubjectName;
         }
+    }
+    if (Options.bOnlyListedPerformers)
+    {
+        return NAME_None;
+    }
+
+    const FString Ip = FIPv4Address(FromIp).ToString();
+    return (Options.DemuxMode == EVMCDemuxMode::SenderEndpoint)
+        ? FName(*FString::Printf(TEXT("%s_%s_%u"), *SubjectName.ToString(), *Ip.Replace(TEXT("."), TEXT("-")), FromPort))
+        : FName(*FString::Printf(TEXT("%s_%s"), *SubjectName.ToString(), *Ip.Replace(TEXT("."), TEXT("-"))));
+}
 
+FVMCPerformer* FVMCLiveLinkSource::FindOrAddPerformer(uint32 FromIp, uint16 FromPort)
+{
+    const uint64 Key = MakeSenderKey(FromIp, FromPort);
+
+    // Consecutive datagrams almost always come from the same sender
+    if (Performers.IsValidIndex(LastPerformer) && Performers[LastPerformer]->SenderKey == Key)
+    {
+        return Performers[LastPerformer].Get();
+    }
+
+    // A handful of performers per port → linear scan
+    for (int32 i = 0; i < Performers.Num(); ++i)
+    {
+        if (Performers[i]->SenderKey == Key)
         {
-            FScopeLock Lock(&DataGuard);
-            PendingRoot = FTransform(QR, PR, FVector(1));
+            LastPerformer = i;
+            return Performers[i].Get();
+        }
+    }
 
-            // Ensure a 'root' exists in the skeleton so we have a slot to apply it
-            if (!BoneNames.Contains(FName("root")))
+    if (Performers.Num() >= FMath::Max(Options.MaxPerformers, 1))
+    {
+        return nullptr;
+    }
+
+    const FName Name = MakePerformerSubjectName(FromIp, FromPort);
+    if (Name.IsNone())
+    {
+        return nullptr; // not a listed performer
+    }
+
+    TUniquePtr<FVMCPerformer> New = MakeUnique<FVMCPerformer>();
+    FVMCPerformer* P = New.Get();
+    P->SubjectName = Name;
+    P->SenderKey = Key;
+
+    if (PlayoutThread.IsValid())
+    {
+        P->JitterBuffer = MakeUnique<FVMCJitterBuffer>(
+            [this, P](const FVMCFrameSnapshot& Frame)
             {
-                BoneNames.Insert(FName("root"), 0);
-                BoneParents.Insert(-1, 0);
-                bStaticSent = false;
-                bForceStaticNext = true;
-            }
-        }
+                PushFrame(*P, Frame);
+            },
+            Options.JitterTargetMs, Options.JitterMaxMs, Options.bJitterAdaptive);
+        PlayoutThread->Register(P->JitterBuffer.Get());
     }
-    else if (Addr == TEXT("/VMC/Ext/Blend/Val"))
+
+    if (Options.ConcealMaxMs > 0.f)
     {
-        const TArray<UE::OSC::FOSCData>& A = Msg.GetArgumentsChecked();
-        if (A.Num() != 2) return;
+        P->Concealer = MakeUnique<FVMCConcealer>(Options.ConcealMaxMs, Options.ConcealBlendMs);
+    }
 
-        const FName CurveName(*A[0].GetString());
-        const float Val = A[1].GetFloat();
+    {
+        FScopeLock Lock(&PerformersLock);
+        LastPerformer = Performers.Add(MoveTemp(New));
+    }
 
-        FScopeLock Lock(&DataGuard);
-        if (!CurveNameToIndex.Contains(CurveName))
+    if (Options.bHumanoidSkeleton)
+    {
+        DeclareHumanoidSkeleton(*P);
+    }
+
+    // Bootstrap settings, then build the remap caches once from them; later rebuilds only
+    // happen when FVMCSettingsVersion moves
+    P->SeenSettingsVersion = FVMCSettingsVersion::Get();
+    P->bRemapRefreshQueued = true;
+    AsyncTask(ENamedThreads::GameThread, [this, P]()
+    {
+        EnsureSubjectSettingsWithDefaults(*P);
+        P->bRemapRefreshQueued = false;
+        RefreshStaticMapsFromSettings(*P);
+    });
+
+    if (Options.DemuxMode != EVMCDemuxMode::None)
+    {
+        UE_LOG(LogVMCLiveLink, Log, TEXT("VMC source '%s': new performer %s:%u → subject '%s'"),
+            *SourceName, *FIPv4Address(FromIp).ToString(), FromPort, *Name.ToString());
+    }
+    return P;
+}
+
+// ---------------- OSC message handler ----------------
+
+void FVMCLiveLinkSource::OnPacketReceived(const FVMCDecodedPacket& Packet)
+{
+    VMC_SCOPED_STAT(HandlePacket);
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    ON_SCOPE_EXIT
+    {
+        IngestCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+    };
+    DatagramsHandled.fetch_add(1, std::memory_order_relaxed);
+    MessagesHandled.fetch_add(Packet.NumMessages, std::memory_order_relaxed);
+    VMC_COUNT(Datagrams, 1);
+    VMC_COUNT(Messages, Packet.NumMessages);
+
+    if (Packet.bMalformed)
+    {
+        MalformedDatagrams.fetch_add(1, std::memory_order_relaxed);
+        VMC_COUNT(ParseFailures, 1);
+        if (Packet.NumMessages == 0 && !Packet.bBundleEnd)
         {
-            const int32 NewIdx = CurveNamesOrdered.Add(CurveName);
-            CurveNameToIndex.Add(CurveName, NewIdx);
-            bStaticCurvesDirty = true; // advertise this name in static data
+            return;   // nothing decoded: not worth a performer
         }
-        PendingCurves.Add(CurveName, Val);
     }
-    else if (Addr == TEXT("/VMC/Ext/Blend/Apply"))
+
+    // Demux once per packet: every message in it belongs to the same sender
+    FVMCPerformer* P = FindOrAddPerformer(Packet.FromIp, Packet.FromPort);
+    if (!P)
+    {
+        RejectedDatagrams.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    P->IngestStats.Datagrams.fetch_add(1, std::memory_order_relaxed);
+    P->IngestStats.Messages.fetch_add(Packet.NumMessages, std::memory_order_relaxed);
+
+    if (!P->bPendingSamples)
+    {
+        P->PendingIngestCycles = StartCycles; // a frame may start in this packet
+    }
+
+    for (int32 i = 0; i < Packet.NumMessages; ++i)
+    {
+        HandleOscMessage(*P, Packet.Messages[i]);
+    }
+
+    if (Packet.bBundleEnd && Options.CommitMode == EVMCFrameCommit::OnBundle)
+    {
+        HandleBundleEnd(*P);
+    }
+}
+
+void FVMCLiveLinkSource::HandleOscMessage(FVMCPerformer& P, const FVMCOscMessage& Msg)
+{
+    float V[8];
+
+    if (Msg.bInBundle && FVMCOscDecoder::IsTimedTag(Msg.TimeTag))
+    {
+        P.PendingTimeTag = Msg.TimeTag;
+    }
+
+    bool bArgsOk = true;   // false: known address with arguments we cannot read (counted)
+    const EVMCAddress Route = FVMCAddressRouter::Resolve(Msg.Address);
+    switch (Route)
     {
-        AsyncTask(ENamedThreads::GameThread, [this]()
+    case EVMCAddress::BonePos:
+        bArgsOk = Msg.NumArgs == 8 && Msg.Args[0].Type == 's' && ReadFloats(Msg, 1, 7, V);
+        if (bArgsOk)
         {
-            if (!bEnsuredDefaults)
-            {
-                EnsureSubjectSettingsWithDefaults();
-            }
-        });
-        RefreshStaticMapsFromSettings();
+            HandleBonePos(P, Msg.Args[0].S, V);
+        }
+        break;
+
+    case EVMCAddress::RootPos:
+        // Spec form is (name, 7f [, scale, offset]); older senders omit the name
+        if (Msg.NumArgs >= 8 && Msg.Args[0].Type == 's' && ReadFloats(Msg, 1, 7, V))
+        {
+            HandleRootPos(P, V);
+        }
+        else if (Msg.NumArgs == 7 && ReadFloats(Msg, 0, 7, V))
+        {
+            HandleRootPos(P, V);
+        }
+        else
+        {
+            bArgsOk = false;
+        }
+        break;
+
+    case EVMCAddress::BlendVal:
+        bArgsOk = Msg.NumArgs == 2 && Msg.Args[0].Type == 's' && Msg.Args[1].IsNumeric();
+        if (bArgsOk)
+        {
+            HandleBlendVal(P, Msg.Args[0].S, Msg.Args[1].AsFloat());
+        }
+        break;
+
+    case EVMCAddress::BlendApply:
+        // In bundle mode the bundle end commits; Apply only covers senders that don't bundle
+        if (Options.CommitMode != EVMCFrameCommit::OnBundle || !Msg.bInBundle)
+        {
+            HandleBlendApply(P);
+        }
+        break;
+
+    case EVMCAddress::TrackerPos:
+    case EVMCAddress::HmdPos:
+    case EVMCAddress::ControllerPos:
+        bArgsOk = Msg.NumArgs >= 8 && Msg.Args[0].Type == 's' && ReadFloats(Msg, 1, 7, V);
+        if (bArgsOk)
+        {
+            HandleDevicePos(P, (uint8)Route, Msg.Args[0].S, V);
+        }
+        break;
 
-        if (bForceStaticNext || !bStaticSent)
+    case EVMCAddress::Camera:
+        bArgsOk = Msg.NumArgs >= 9 && Msg.Args[0].Type == 's' && ReadFloats(Msg, 1, 8, V);
+        if (bArgsOk)
         {
-            bForceStaticNext = false;
-            PushStaticData(/*bForce=*/true);
+            HandleCamera(P, Msg.Args[0].S, V, V[7]);
         }
+        break;
+
+    case EVMCAddress::Ok:
+        HandleStatus(P, Msg);
+        break;
+
+    case EVMCAddress::Time:
+        bArgsOk = Msg.NumArgs >= 1 && Msg.Args[0].IsNumeric();
+        if (bArgsOk)
+        {
+            P.SenderTime.store(Msg.Args[0].AsFloat(), std::memory_order_relaxed);
+        }
+        break;
+
+    default:
+        P.IngestStats.UnknownAddresses.fetch_add(1, std::memory_order_relaxed);
+        break;
+    }
+
+    if (!bArgsOk)
+    {
+        P.IngestStats.BadMessages.fetch_add(1, std::memory_order_relaxed);
+        VMC_COUNT(ParseFailures, 1);
+    }
+}
 
-        PushStaticData(/*bForce=*/false);
-        PushFrame();
+void FVMCLiveLinkSource::HandleBonePos(FVMCPerformer& P, FUtf8StringView Bone, const float* V)
+{
+    bool bAdded = false;
+    const int32 Slot = P.BoneTable.FindOrAdd(Bone, bAdded);
+    if (bAdded)
+    {
+        // Bones outside the humanoid schema (or every bone without it) land here; the layout is
+        // rebuilt once at the next commit, however many arrived in the frame.
+        // Default: first seen bone becomes root (-1 parent). Others parent to 0 unless explicitly "root".
+        int32 Parent = P.BoneNames.Num() == 0 ? -1 : 0;
+        if (Bone.Equals(UTF8TEXTVIEW("root"), ESearchCase::IgnoreCase)) Parent = -1;
+        P.BoneNames.Add(P.BoneTable.GetName(Slot));
+        P.BoneParents.Add(Parent);
+        P.BoneSlots.Add(Slot);
+        P.GrowPoseSlots();
+        P.bLayoutDirty = true;          // ensure we republish new skeleton
+    }
 
-        FScopeLock Lock(&DataGuard);
-        PendingCurves.Reset();
+    // Stored as sent; CommitFrame converts the whole frame at once
+    float* Raw = P.PendingPoseRaw.GetData() + Slot * FVMCPerformer::RawPoseStride;
+    Raw[0] = V[0]; Raw[1] = V[1]; Raw[2] = V[2]; Raw[3] = 0.f;
+    Raw[4] = V[3]; Raw[5] = V[4]; Raw[6] = V[5]; Raw[7] = V[6];
+    P.PendingPoseValid[Slot] = 1;
+    P.bPendingSamples = true;
+}
 
-        if (bStaticCurvesDirty)
+void FVMCLiveLinkSource::HandleRootPos(FVMCPerformer& P, const float* V)
+{
+    // Converted at commit (with the extra yaw offset about UE Z)
+    FMemory::Memcpy(P.PendingRootRaw, V, sizeof(P.PendingRootRaw));
+    P.bPendingRootRaw = true;
+    P.bPendingSamples = true;
+
+    // Ensure a 'root' exists in the skeleton so we have a slot to apply it
+    bool bAdded = false;
+    const int32 Slot = P.BoneTable.FindOrAdd(UTF8TEXTVIEW("root"), bAdded);
+    if (bAdded)
+    {
+        // Stream-built skeleton only (the humanoid schema declares root up front): shift the
+        // existing parent indices along with their bones
+        for (int32& Parent : P.BoneParents)
         {
-            bStaticCurvesDirty = false;
-            PushStaticData(/*bForce=*/true);
+            if (Parent != INDEX_NONE) ++Parent;
         }
+        if (P.HipsIndex != INDEX_NONE) ++P.HipsIndex;
+        P.BoneNames.Insert(P.BoneTable.GetName(Slot), 0);
+        P.BoneParents.Insert(-1, 0);
+        P.BoneSlots.Insert(Slot, 0);
+        P.GrowPoseSlots();
+        P.bLayoutDirty = true;
+    }
+}
+
+void FVMCLiveLinkSource::HandleBlendVal(FVMCPerformer& P, FUtf8StringView Curve, float Val)
+{
+    bool bAdded = false;
+    const int32 Slot = P.CurveTable.FindOrAdd(Curve, bAdded);
+    if (bAdded)
+    {
+        P.CurveNamesOrdered.Add(P.CurveTable.GetName(Slot)); // index == slot
+        P.PendingCurves.SetNumZeroed(P.CurveTable.Num());
+        P.PendingCurveValid.SetNumZeroed(P.CurveTable.Num());
+        P.bStaticCurvesDirty = true; // advertise this name in static data
+        P.bLayoutDirty = true;
+    }
+    P.PendingCurves[Slot] = Val;
+    P.PendingCurveValid[Slot] = 1;
+    P.bPendingSamples = true;
+}
+
+void FVMCLiveLinkSource::HandleBlendApply(FVMCPerformer& P)
+{
+    ApplyFrame(P);
+}
+
+void FVMCLiveLinkSource::HandleBundleEnd(FVMCPerformer& P)
+{
+    // Status-only bundles (/OK, /T) must not repeat the previous frame
+    if (P.bPendingSamples)
+    {
+        ApplyFrame(P);
     }
 }
 
+void FVMCLiveLinkSource::ApplyFrame(FVMCPerformer& P)
+{
+    // Settings edits bump a version; only then are the remap caches rebuilt (on the game thread)
+    const uint32 SettingsVersion = FVMCSettingsVersion::Get();
+    if (SettingsVersion != P.SeenSettingsVersion)
+    {
+        P.SeenSettingsVersion = SettingsVersion;
+        RequestRemapRefresh(P);
+    }
+    AdoptRemapState(P);
+
+    // Static republishes ride on a new layout version; the push step sends static data
+    // before the first frame that uses it, whichever thread it runs on
+    if (P.bForceStaticNext.exchange(false) || P.bStaticCurvesDirty)
+    {
+        P.bLayoutDirty = true;
+    }
+    P.bStaticCurvesDirty = false;
+
+    CommitFrame(P);
+
+    // Without a jitter buffer the frame goes out on this thread, unless the output policy
+    // thins pushes (then the newest commit waits in the hand-off)
+    if (!P.JitterBuffer.IsValid() && ShouldPushOnCommit(P))
+    {
+        PushLatestFrame(P);
+    }
+
+    // Curves are per-frame: anything not re-sent before the next Apply reads 0
+    FMemory::Memzero(P.PendingCurveValid.GetData(), P.PendingCurveValid.Num());
+}
+
+FTransform FVMCLiveLinkSource::ToUEWorldTransform(const float* V) const
+{
+    FVector P = ToUEPosition(bUnityToUE, bMetersToCm, V[0], V[1], V[2]);
+    FQuat   Q = ToUERotation(bUnityToUE, V[3], V[4], V[5], V[6]);
+
+    // Same yaw re-expression as the root so devices stay aligned with the avatar
+    if (!FMath::IsNearlyZero(YawOffsetDeg))
+    {
+        const FQuat YawDelta(FVector::UpVector, FMath::DegreesToRadians(YawOffsetDeg));
+        Q = YawDelta * Q;
+        P = YawDelta.RotateVector(P);
+    }
+    return FTransform(Q, P, FVector(1));
+}
+
+FVMCDeviceSubject& FVMCLiveLinkSource::FindOrAddDeviceSubject(FVMCPerformer& P, uint8 Kind, FUtf8StringView Serial)
+{
+    // A handful of devices per performer → linear byte compare beats hashing here
+    for (FVMCDeviceSubject& D : P.DeviceSubjects)
+    {
+        if (D.Kind == Kind && D.Serial.Num() == Serial.Len() && FMemory::Memcmp(D.Serial.GetData(), Serial.GetData(), Serial.Len()) == 0)
+        {
+            return D;
+        }
+    }
+
+    const TCHAR* KindTag = TEXT("Dev");
+    switch ((EVMCAddress)Kind)
+    {
+    case EVMCAddress::TrackerPos:    KindTag = TEXT("Tra"); break;
+    case EVMCAddress::HmdPos:        KindTag = TEXT("Hmd"); break;
+    case EVMCAddress::ControllerPos: KindTag = TEXT("Con"); break;
+    case EVMCAddress::Camera:        KindTag = TEXT("Cam"); break;
+    default: break;
+    }
+
+    FVMCDeviceSubject& D = P.DeviceSubjects.AddDefaulted_GetRef();
+    D.Kind = Kind;
+    D.Serial.Append(Serial.GetData(), Serial.Len());
+    D.SubjectName = FName(*FString::Printf(TEXT("%s_%s_%s"), *P.SubjectName.ToString(), KindTag, *FString(Serial)));
+    return D;
+}
+
+void FVMCLiveLinkSource::HandleDevicePos(FVMCPerformer& P, uint8 Kind, FUtf8StringView Serial, const float* V)
+{
+    if (!Client) return;
+
+    FVMCDeviceSubject& D = FindOrAddDeviceSubject(P, Kind, Serial);
+    const FLiveLinkSubjectKey Key{ SourceGuid, D.SubjectName };
+
+    if (!D.bStaticSent)
+    {
+        FLiveLinkStaticDataStruct StaticData(FLiveLinkTransformStaticData::StaticStruct());
+        Client->PushSubjectStaticData_AnyThread(Key, ULiveLinkTransformRole::StaticClass(), MoveTemp(StaticData));
+        D.bStaticSent = true;
+    }
+
+    FLiveLinkFrameDataStruct Frame(FLiveLinkTransformFrameData::StaticStruct());
+    Frame.Cast<FLiveLinkTransformFrameData>()->Transform = ToUEWorldTransform(V);
+    Client->PushSubjectFrameData_AnyThread(Key, MoveTemp(Frame));
+}
+
+void FVMCLiveLinkSource::HandleCamera(FVMCPerformer& P, FUtf8StringView Name, const float* V, float Fov)
+{
+    if (!Client) return;
+
+    FVMCDeviceSubject& D = FindOrAddDeviceSubject(P, (uint8)EVMCAddress::Camera, Name);
+    const FLiveLinkSubjectKey Key{ SourceGuid, D.SubjectName };
+
+    if (!D.bStaticSent)
+    {
+        FLiveLinkStaticDataStruct StaticData(FLiveLinkCameraStaticData::StaticStruct());
+        StaticData.Cast<FLiveLinkCameraStaticData>()->bIsFieldOfViewSupported = true;
+        Client->PushSubjectStaticData_AnyThread(Key, ULiveLinkCameraRole::StaticClass(), MoveTemp(StaticData));
+        D.bStaticSent = true;
+    }
+
+    FTransform Xf = ToUEWorldTransform(V);
+    if (bUnityToUE)
+    {
+        // Unity cameras look down local +Z, which lands on UE local +Y after the basis swap;
+        // UE cameras look down local +X, so turn the local frame by +90° yaw.
+        Xf.SetRotation(Xf.GetRotation() * FQuat(FVector::UpVector, HALF_PI));
+    }
+
+    FLiveLinkFrameDataStruct Frame(FLiveLinkCameraFrameData::StaticStruct());
+    FLiveLinkCameraFrameData& Cam = *Frame.Cast<FLiveLinkCameraFrameData>();
+    Cam.Transform = Xf;
+    Cam.FieldOfView = Fov; // sender value in degrees (Unity reports vertical FOV)
+    Client->PushSubjectFrameData_AnyThread(Key, MoveTemp(Frame));
+}
+
+void FVMCLiveLinkSource::HandleStatus(FVMCPerformer& P, const FVMCOscMessage& Msg)
+{
+    // (loaded) | (loaded, calib state, calib mode) | (loaded, calib state, calib mode, tracking)
+    if (Msg.NumArgs >= 1) P.SenderLoaded.store(Msg.Args[0].AsInt(), std::memory_order_relaxed);
+    if (Msg.NumArgs >= 3)
+    {
+        P.SenderCalibrationState.store(Msg.Args[1].AsInt(), std::memory_order_relaxed);
+        P.SenderCalibrationMode.store(Msg.Args[2].AsInt(), std::memory_order_relaxed);
+    }
+    if (Msg.NumArgs >= 4) P.SenderTrackingStatus.store(Msg.Args[3].AsInt(), std::memory_order_relaxed);
+}
+
 // ---------------- Live Link data push ----------------
 
-void FVMCLiveLinkSource::PushStaticData(bool bForce)
+void FVMCLiveLinkSource::DeclareHumanoidSkeleton(FVMCPerformer& P)
 {
-    FScopeLock Lock(&DataGuard);
+    // Names are interned in schema order, so schema index == output index == pose slot
+    check(P.BoneTable.Num() == 0);
+
+    const int32 Num = VMCHumanoidSchema::NumBones;
+    P.BoneNames.Reserve(Num);
+    P.BoneParents.Reserve(Num);
+    P.BoneSlots.Reserve(Num);
+    for (const FVMCHumanoidBone& B : VMCHumanoidSchema::Bones)
+    {
+        bool bAdded = false;
+        const int32 Slot = P.BoneTable.FindOrAdd(FUtf8StringView(B.Name), bAdded);
+        P.BoneNames.Add(P.BoneTable.GetName(Slot));
+        P.BoneParents.Add(B.Parent);
+        P.BoneSlots.Add(Slot);
+    }
+    P.HipsIndex = VMCHumanoidSchema::Hips;
 
-    const bool bHaveBones = BoneNames.Num() > 0;
-    if (!Client || (!bForce && (bStaticSent || !bHaveBones)))
+    P.GrowPoseSlots();
+    P.bLayoutDirty = true;
+}
+
+void FVMCLiveLinkSource::RebuildLayout(FVMCPerformer& P)
+{
+    TSharedRef<FVMCStaticLayout, ESPMode::ThreadSafe> L = MakeShared<FVMCStaticLayout, ESPMode::ThreadSafe>();
+    L->BoneNames = P.BoneNames;
+    L->BoneParents = P.BoneParents;
+
+    // Apply cached maps once (preserve order → indices remain valid)
+    const FVMCRemapState* Remap = P.Remap.Get();
+    L->MappedBoneNames = P.BoneNames;
+    L->MappedCurveNames = P.CurveNamesOrdered;
+    if (Remap)
+    {
+        for (FName& N : L->MappedBoneNames)  if (const FName* M = Remap->BoneMap.Find(N))  N = *M;
+        for (FName& C : L->MappedCurveNames) if (const FName* M = Remap->CurveMap.Find(C)) C = *M;
+    }
+
+    // Compile the per-bone output plan (all lookups happen here, not per frame)
+    const bool bRefUsable = bUseRefOffsets && Remap && Remap->bHaveRefOffsets;
+    const int32 NumBones = P.BoneNames.Num();
+    L->BonePlan.SetNum(NumBones);
+    for (int32 i = 0; i < NumBones; ++i)
     {
+        FVMCBonePlan& B = L->BonePlan[i];
+        B.Slot = P.BoneSlots[i];
+        B.Parent = P.BoneParents.IsValidIndex(i) ? P.BoneParents[i] : INDEX_NONE;
+
+        const FVector* Ref = bRefUsable ? Remap->RefLocalTranslationByName.Find(L->MappedBoneNames[i]) : nullptr;
+        if (Ref)
+        {
+            B.RefTranslation = *Ref;
+        }
+
+        if (B.Parent == INDEX_NONE)
+        {
+            B.Policy = EVMCTranslationPolicy::Root;
+        }
+        else if (i == P.HipsIndex)
+        {
+            B.Policy = EVMCTranslationPolicy::Incoming; // body translation relative to root
+        }
+        else if (bPreferIncomingTranslations)
+        {
+            B.Policy = Ref ? EVMCTranslationPolicy::IncomingElseRef : EVMCTranslationPolicy::Incoming;
+        }
+        else
+        {
+            B.Policy = Ref ? EVMCTranslationPolicy::RefOffset : EVMCTranslationPolicy::Zero;
+        }
+    }
+
+    // Property index → curve slot (identity today: curve slots are appended in property order)
+    L->CurveSlots.SetNumUninitialized(P.CurveNamesOrdered.Num());
+    for (int32 i = 0; i < P.CurveNamesOrdered.Num(); ++i)
+    {
+        L->CurveSlots[i] = i;
+    }
+
+    L->Version = P.CurrentLayout.IsValid() ? P.CurrentLayout->Version + 1 : 1;
+
+    P.CurrentLayout = L;
+    P.bLayoutDirty = false;
+}
+
+void FVMCLiveLinkSource::CommitFrame(FVMCPerformer& P)
+{
+    VMC_SCOPED_STAT(CommitFrame);
+    if (P.bLayoutDirty || !P.CurrentLayout.IsValid())
+    {
+        RebuildLayout(P);
+    }
+
+    FVMCFrameSnapshot* Slot = P.JitterBuffer.IsValid() ? P.JitterBuffer->BeginWrite() : &P.FrameExchange.BeginWrite();
+    if (!Slot)
+    {
+        // Jitter ring full (playout stalled); counted there
+        P.PendingTimeTag = 0;
+        P.bPendingSamples = false;
         return;
     }
 
-    // Make editable copies
-    TArray<FName> OutBoneNames = BoneNames;
-    TArray<FName> OutCurveNames = CurveNamesOrdered;
+    FVMCFrameSnapshot& W = *Slot;
+    W.Layout = P.CurrentLayout;
+
+    // One vectorized pass converts the frame's raw Unity samples straight into the snapshot
+    const int32 NumSlots = P.PendingPoseValid.Num();
+    W.Pose.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+    ConvertPoseBatch(P.PendingPoseRaw.GetData(), P.PendingPoseValid.GetData(), P.PoseHemisphere.GetData(), W.Pose.GetData(),
+        NumSlots, bUnityToUE, bMetersToCm);
+    if (P.bPendingRootRaw)
+    {
+        P.PendingRoot = ToUEWorldTransform(P.PendingRootRaw);
+        P.bPendingRootRaw = false;
+    }
 
-    // Apply cached maps (preserve order → indices remain valid)
-    for (FName& N : OutBoneNames)  if (const FName* M = CachedBoneMap.Find(N))  N = *M;
-    for (FName& C : OutCurveNames) if (const FName* M = CachedCurveMap.Find(C)) C = *M;
+    FVMCFrameExchange::CopyDense(W.PoseValid, P.PendingPoseValid);
+    FVMCFrameExchange::CopyDense(W.Curves, P.PendingCurves);
+    FVMCFrameExchange::CopyDense(W.CurveValid, P.PendingCurveValid);
+    W.Root = P.PendingRoot;
+    W.Sequence = ++P.FrameSequence;
+    W.CommitSeconds = FPlatformTime::Seconds();
+    W.WorldSeconds = W.CommitSeconds;
+    W.SenderSeconds = -1.0;
+    W.IngestCycles = P.PendingIngestCycles;
+
+    if (Options.bUseSenderTime && FVMCOscDecoder::IsTimedTag(P.PendingTimeTag))
+    {
+        // Map sender time onto the local clock. The smallest (arrival - sent) seen is the best
+        // estimate of clock offset + minimum latency; it is released slowly to follow drift and
+        // re-seeded when the sender clock jumps.
+        const double Sent = FVMCOscDecoder::TimeTagToSeconds(P.PendingTimeTag);
+        const double Sample = W.CommitSeconds - Sent;
+        if (!P.bHaveSenderClock || Sample < P.SenderClockOffset || FMath::Abs(Sample - P.SenderClockOffset) > 1.0)
+        {
+            P.SenderClockOffset = Sample;
+            P.bHaveSenderClock = true;
+        }
+        else
+        {
+            P.SenderClockOffset += (Sample - P.SenderClockOffset) * 0.001;
+        }
+        W.WorldSeconds = Sent + P.SenderClockOffset;
+        W.SenderSeconds = Sent;
+    }
+    P.PendingTimeTag = 0;
+    P.bPendingSamples = false;
 
-    // Build static packet
+    ++P.OutputStats.Committed;
+    if (P.JitterBuffer.IsValid())
+    {
+        P.JitterBuffer->Publish();
+    }
+    else
+    {
+        if (P.FrameExchange.HasUnconsumed())
+        {
+            ++P.OutputStats.Coalesced;
+        }
+        P.FrameExchange.Publish();
+    }
+}
+
+void FVMCLiveLinkSource::PushLatestFrame(FVMCPerformer& P)
+{
+    if (const FVMCFrameSnapshot* Snapshot = P.FrameExchange.ConsumeLatest())
+    {
+        PushFrame(P, *Snapshot);
+    }
+}
+
+void FVMCLiveLinkSource::PushStaticData(FVMCPerformer& P, const FVMCStaticLayout& L)
+{
+    if (!Client)
+    {
+        return;
+    }
+    VMC_SCOPED_STAT(PushStaticData);
+
+    // Build static packet (names already mapped when the layout was built)
     FLiveLinkStaticDataStruct StaticData(FLiveLinkSkeletonStaticData::StaticStruct());
     auto& Skel = *StaticData.Cast<FLiveLinkSkeletonStaticData>();
 
-    Skel.SetBoneNames(OutBoneNames);
-    Skel.SetBoneParents(BoneParents);
+    Skel.SetBoneNames(L.MappedBoneNames);
+    Skel.SetBoneParents(L.BoneParents);
 
     // UE 5.6: curve names live on the base static data array
-    Skel.PropertyNames = OutCurveNames;
+    Skel.PropertyNames = L.MappedCurveNames;
 
-    Client->PushSubjectStaticData_AnyThread({ SourceGuid, SubjectName },
+    Client->PushSubjectStaticData_AnyThread({ SourceGuid, P.SubjectName },
         ULiveLinkAnimationRole::StaticClass(), MoveTemp(StaticData));
 
-    bStaticSent = true;
+    P.bStaticSent = true;
+    P.OutputStats.StaticPushes.fetch_add(1, std::memory_order_relaxed);
+    VMC_COUNT(StaticPushes, 1);
 }
 
-void FVMCLiveLinkSource::PushFrame()
+bool FVMCLiveLinkSource::PushFrame(FVMCPerformer& P, const FVMCFrameSnapshot& Snapshot)
 {
-    if (!Client) return;
+    if (!Client || !Snapshot.Layout.IsValid()) return false;
+
+    VMC_SCOPED_STAT(PushFrame);
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    ON_SCOPE_EXIT
+    {
+        P.OutputStats.PushCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+    };
 
-    // Snapshot state under lock
-    TArray<FName>            LocalBoneNames;
-    TArray<int32>            LocalBoneParents;
-    TMap<FName, FTransform>  LocalPose;
-    FTransform               LocalRoot = FTransform::Identity;
-    TArray<FName>            LocalCurveNames;
-    TMap<FName, int32>       LocalCurveNameToIndex;
-    TMap<FName, float>       LocalCurves;
-
-    TMap<FName, FName>       LocalBoneMap;                 // source → mapped
-    TMap<FName, FVector>     LocalRefOffsets;              // mapped name → ref local translation
-    bool                     bLocalUseRefOffsets = true;
-    bool                     bLocalPreferIncoming = false;
-    bool                     bLocalHaveRefOffsets = false;
-
-    {
-        FScopeLock Lock(&DataGuard);
-        LocalBoneNames = BoneNames;
-        LocalBoneParents = BoneParents;
-        LocalPose = PendingPose;
-        LocalRoot = PendingRoot;
-        LocalCurveNames = CurveNamesOrdered;
-        LocalCurveNameToIndex = CurveNameToIndex;
-        LocalCurves = PendingCurves;
-
-        LocalBoneMap = CachedBoneMap;
-        LocalRefOffsets = RefLocalTranslationByName;
-        bLocalUseRefOffsets = bUseRefOffsets;
-        bLocalPreferIncoming = bPreferIncomingTranslations;
-        bLocalHaveRefOffsets = bHaveRefOffsets;
+    FScopeLock Lock(&P.PushLock);
+
+    // Static goes out before the first frame that uses new bones/curves/names
+    const bool bNewLayout = Snapshot.Layout != P.LastPushedLayout;
+    if (bNewLayout)
+    {
+        PushStaticData(P, *Snapshot.Layout);
+        P.LastPushedLayout = Snapshot.Layout;
     }
 
+    const FVMCStaticLayout& L = *Snapshot.Layout;
+    const int32 NumBones = L.BonePlan.Num();
+    const int32 NumCurves = L.CurveSlots.Num();
+
     // Build frame payload
     FLiveLinkFrameDataStruct Frame(FLiveLinkAnimationFrameData::StaticStruct());
     auto& Anim = *Frame.Cast<FLiveLinkAnimationFrameData>();
     FLiveLinkBaseFrameData& Base = static_cast<FLiveLinkBaseFrameData&>(Anim);
 
-    const int32 NumBones = LocalBoneNames.Num();
-    const int32 NumCurves = LocalCurveNames.Num();
+    // Timing: sender time when the bundle carried a timetag, else commit time
+    Base.WorldTime = FLiveLinkWorldTime(Snapshot.WorldSeconds);
+    if (Snapshot.SenderSeconds >= 0.0)
+    {
+        // NTP days start at 00:00 UTC, so the remainder is the sender's time of day
+        const FFrameRate Rate = FApp::GetTimecodeFrameRate();
+        Base.MetaData.SceneTime = FQualifiedFrameTime(Rate.AsFrameTime(FMath::Fmod(Snapshot.SenderSeconds, 86400.0)), Rate);
+    }
 
-    Anim.Transforms.SetNum(NumBones);
-    Base.PropertyValues.SetNum(NumCurves);
-    for (int32 i = 0; i < NumCurves; ++i) Base.PropertyValues[i] = 0.f;
+    Anim.Transforms.SetNumUninitialized(NumBones);
+    Base.PropertyValues.SetNumUninitialized(NumCurves);
 
-    auto MapBoneName = [&](const FName& Src)->FName
-        {
-            if (const FName* M = LocalBoneMap.Find(Src)) return *M;
-            return Src;
-        };
+    const FVMCBonePlan* Plan = L.BonePlan.GetData();
+    const FTransform* Pose = Snapshot.Pose.GetData();
+    const uint8* PoseValid = Snapshot.PoseValid.GetData();
+    FTransform* Out = Anim.Transforms.GetData();
 
-    // Fill transforms as LOCAL (parent-space) per Live Link Animation Role
+    // Fill transforms as LOCAL (parent-space) per Live Link Animation Role: one linear pass over the plan
     for (int32 i = 0; i < NumBones; ++i)
     {
-        const FName SrcName = LocalBoneNames[i];
-        FTransform X = FTransform::Identity;
+        const FVMCBonePlan& B = Plan[i];
+        const bool bIn = PoseValid[B.Slot] != 0;
+        const FTransform& In = Pose[B.Slot];
 
-        // Rotation from incoming stream (if present)
-        if (const FTransform* In = LocalPose.Find(SrcName))
+        FTransform X = FTransform::Identity;
+        if (bIn)
         {
-            X.SetRotation(In->GetRotation());
-            if (bLocalPreferIncoming) // only if your stream provides proper local translations
-                X.SetTranslation(In->GetTranslation());
+            X.SetRotation(In.GetRotation());
         }
 
-        // Translation handling
-        if (LocalBoneParents.IsValidIndex(i) && LocalBoneParents[i] == -1)
+        switch (B.Policy)
         {
-            // Root gets live root translation
-            const FTransform* In = LocalPose.Find(SrcName);
-            X.SetTranslation(In->GetTranslation());
+        case EVMCTranslationPolicy::Root:
+            // Root gets live root translation; a synthesized 'root' (from /Root/Pos) has no
+            // bone sample, so it takes the root transform itself
+            if (bIn) X.SetTranslation(In.GetTranslation());
+            else     X = Snapshot.Root;
+            break;
+        case EVMCTranslationPolicy::RefOffset:
+            X.SetTranslation(B.RefTranslation);
+            break;
+        case EVMCTranslationPolicy::Incoming:
+            if (bIn) X.SetTranslation(In.GetTranslation());
+            break;
+        case EVMCTranslationPolicy::IncomingElseRef:
+            X.SetTranslation((bIn && !In.GetTranslation().IsNearlyZero()) ? In.GetTranslation() : B.RefTranslation);
+            break;
+        default:
+            break;
         }
-        else
-        {
-            // Rotation from incoming stream (if present)
-            if (const FTransform* In = LocalPose.Find(SrcName))
-            {
-                X.SetRotation(In->GetRotation());
-                if (bLocalPreferIncoming)
-                {
-                    X.SetTranslation(In->GetTranslation());
-                }
-            }
 
-            // Translation handling
-            if (!bLocalPreferIncoming || X.GetTranslation().IsNearlyZero())
-            {
-                if (bLocalUseRefOffsets && bLocalHaveRefOffsets)
-                {
-                    const FName Mapped = MapBoneName(SrcName);
-                    if (const FVector* Off = LocalRefOffsets.Find(Mapped))
-                    {
-                        X.SetTranslation(*Off);
-                    }
-                }
-            }
-        }
+        Out[i] = X;
+    }
 
-        Anim.Transforms[i] = X;
+    // Curves → PropertyValues through the dense slot table; curves not sent this frame read 0
+    const int32* CurveSlots = L.CurveSlots.GetData();
+    const float* Curves = Snapshot.Curves.GetData();
+    const uint8* CurveValid = Snapshot.CurveValid.GetData();
+    float* Values = Base.PropertyValues.GetData();
+    for (int32 i = 0; i < NumCurves; ++i)
+    {
+        const int32 C = CurveSlots[i];
+        Values[i] = CurveValid[C] ? Curves[C] : 0.f;
     }
 
-    // Curves → PropertyValues using fixed order
-    for (const TPair<FName, float>& KV : LocalCurves)
+    const double Now = FPlatformTime::Seconds();
+
+    // Concealment learns from every real frame, pushed or not (and blends it in after a gap)
+    if (P.Concealer.IsValid())
     {
-        if (const int32* Idx = LocalCurveNameToIndex.Find(KV.Key))
-        {
-            const int32 I = *Idx;
-            if (Base.PropertyValues.IsValidIndex(I))
-            {
-                Base.PropertyValues[I] = KV.Value;
-            }
-        }
+        P.Concealer->OnRealFrame(Now, Anim.Transforms);
+        P.LastPushedWorldOffset = Snapshot.WorldSeconds - Now;
+    }
+
+    // Idle deadband: nothing moved past the epsilons since the last push → skip until the heartbeat
+    if (Options.bDeadband && !bNewLayout
+        && Now - P.LastPushSeconds < Options.DeadbandHeartbeatMs * 0.001
+        && P.LastPushedTransforms.Num() == NumBones && P.LastPushedValues.Num() == NumCurves
+        && PoseWithinDeadband(Out, P.LastPushedTransforms.GetData(), NumBones,
+            FMath::DegreesToRadians(Options.DeadbandRotationDeg) * 0.5f, Options.DeadbandTranslationCm)
+        && CurvesWithinDeadband(Values, P.LastPushedValues.GetData(), NumCurves, Options.DeadbandCurve))
+    {
+        ++P.OutputStats.Suppressed;
+        return false;
+    }
+
+    if (Options.bDeadband)
+    {
+        FVMCFrameExchange::CopyDense(P.LastPushedTransforms, Anim.Transforms);
+    }
+    if (Options.bDeadband || P.Concealer.IsValid())
+    {
+        FVMCFrameExchange::CopyDense(P.LastPushedValues, Base.PropertyValues);
+    }
+    P.LastPushSeconds = Now;
+
+    ++P.OutputStats.Pushed;
+    if (Snapshot.IngestCycles != 0)
+    {
+        const double LatencyUs = FPlatformTime::ToSeconds64(StartCycles - Snapshot.IngestCycles) * 1e6;
+        P.OutputStats.Latency[FVMCLiveLinkSourceStats::LatencyBucket(LatencyUs)].fetch_add(1, std::memory_order_relaxed);
     }
+    if (Snapshot.CommitSeconds > 0.0)
+    {
+        const double ApplyUs = (Now - Snapshot.CommitSeconds) * 1e6;
+        P.OutputStats.ApplyLatency[FVMCLiveLinkSourceStats::LatencyBucket(ApplyUs)].fetch_add(1, std::memory_order_relaxed);
+    }
+    VMC_COUNT(FramesPushed, 1);
 
-    Client->PushSubjectFrameData_AnyThread({ SourceGuid, SubjectName }, MoveTemp(Frame));
+    Client->PushSubjectFrameData_AnyThread({ SourceGuid, P.SubjectName }, MoveTemp(Frame));
+    return true;
 }
 
 uint32 FVMCLiveLinkSource::HashMaps(const TMap<FName, FName>& A, const TMap<FName, FName>& B)
@@ -449,27 +1435,42 @@ uint32 FVMCLiveLinkSource::HashMaps(const TMap<FName, FName>& A, const TMap<FNam
     return H;
 }
 
-void FVMCLiveLinkSource::RefreshStaticMapsIfNeeded()
+void FVMCLiveLinkSource::RequestRemapRefresh(FVMCPerformer& P)
 {
-    UVMCLiveLinkRemapper* R = StaticNameRemapper.LoadSynchronous();
-    if (!R) return;
+    // One rebuild in flight at most; a bump while it runs queues the next one
+    if (P.bRemapRefreshQueued.exchange(true))
+    {
+        return;
+    }
 
-    const uint32 NewHash = HashMaps(R->BoneNameMap, R->CurveNameMap);
-    if (NewHash != CachedMapsHash)
+    FVMCPerformer* Performer = &P;
+    AsyncTask(ENamedThreads::GameThread, [this, Performer]()
     {
-        CachedMapsHash = NewHash;
-        CachedBoneMap = R->BoneNameMap;
-        CachedCurveMap = R->CurveNameMap;
+        Performer->bRemapRefreshQueued = false;
+        RefreshStaticMapsFromSettings(*Performer);
+    });
+}
 
-        // Force one static publish on next /Apply to propagate new names
-        bForceStaticNext = true;
+void FVMCLiveLinkSource::AdoptRemapState(FVMCPerformer& P)
+{
+    if (!P.bRemapReady.load(std::memory_order_acquire))
+    {
+        return;
     }
+
+    {
+        FScopeLock Lock(&P.RemapLock);
+        P.Remap = MoveTemp(P.PendingRemap);
+        P.PendingRemap.Reset();
+        P.bRemapReady = false;
+    }
+    P.bLayoutDirty = true; // names / ref offsets may have changed → new layout + static republish
 }
 
-void FVMCLiveLinkSource::BuildRefOffsetsFromMesh(USkeletalMesh* Mesh)
+void FVMCLiveLinkSource::BuildRefOffsetsFromMesh(FVMCPerformer& P, USkeletalMesh* Mesh)
 {
-    RefLocalTranslationByName.Empty();
-    bHaveRefOffsets = false;
+    P.RefLocalTranslationByName.Empty();
+    P.bHaveRefOffsets = false;
     if (!Mesh) return;
 
     const FReferenceSkeleton& RS = Mesh->GetRefSkeleton();
@@ -478,26 +1479,25 @@ void FVMCLiveLinkSource::BuildRefOffsetsFromMesh(USkeletalMesh* Mesh)
     for (int32 i = 0; i < Num; ++i)
     {
         const FName Bone = RS.GetBoneName(i);
-        RefLocalTranslationByName.Add(Bone, RefPose[i].GetTranslation());
+        P.RefLocalTranslationByName.Add(Bone, RefPose[i].GetTranslation());
     }
-    bHaveRefOffsets = true;
+    P.bHaveRefOffsets = true;
 }
 
-// Pull remapper + maps + ReferenceSkeleton from subject settings
-void FVMCLiveLinkSource::RefreshStaticMapsFromSettings()
+// Pull remapper + maps + ReferenceSkeleton from subject settings (game thread) and publish
+// them to the ingest thread when anything changed
+void FVMCLiveLinkSource::RefreshStaticMapsFromSettings(FVMCPerformer& P)
 {
+    check(IsInGameThread());
     if (!Client) return;
+    VMC_SCOPED_STAT(RefreshStaticMaps);
 
-    UObject* SettingsObj = Client->GetSubjectSettings({ SourceGuid, SubjectName });
+    UObject* SettingsObj = Client->GetSubjectSettings({ SourceGuid, P.SubjectName });
     ULiveLinkSubjectSettings* Settings = Cast<ULiveLinkSubjectSettings>(SettingsObj);
     ULiveLinkSubjectRemapper* NowRemapper = Settings ? Settings->Remapper : nullptr;
 
-    const bool bRemapperChanged = (LastSeenRemapper.Get() != NowRemapper);
-    if (bRemapperChanged)
-    {
-        LastSeenRemapper = NowRemapper;
-        bForceStaticNext = true; // names may change
-    }
+    bool bChanged = (P.LastSeenRemapper.Get() != NowRemapper); // names may change
+    P.LastSeenRemapper = NowRemapper;
 
     // Pull maps + reference mesh
     TMap<FName, FName> NewBone, NewCurve;
@@ -515,38 +1515,87 @@ void FVMCLiveLinkSource::RefreshStaticMapsFromSettings()
     }
 
     //  - Rebuild offsets if mesh changed or cache invalid
-    const bool bMeshChanged = (LastRefMeshBuiltFrom.Get() != RefMesh);
-    const bool bNeverBuilt = !bHaveRefOffsets || RefLocalTranslationByName.Num() == 0;
-    const bool bCountMismatch = RefMesh && (RefLocalTranslationByName.Num() != RefMesh->GetRefSkeleton().GetNum());
+    const bool bMeshChanged = (P.LastRefMeshBuiltFrom.Get() != RefMesh);
+    const bool bNeverBuilt = !P.bHaveRefOffsets || P.RefLocalTranslationByName.Num() == 0;
+    const bool bCountMismatch = RefMesh && (P.RefLocalTranslationByName.Num() != RefMesh->GetRefSkeleton().GetNum());
 
     if (RefMesh && (bMeshChanged || bNeverBuilt || bCountMismatch))
     {
-        BuildRefOffsetsFromMesh(RefMesh);
-        LastRefMeshBuiltFrom = RefMesh;
+        BuildRefOffsetsFromMesh(P, RefMesh);
+        P.LastRefMeshBuiltFrom = RefMesh;
+        bChanged = true;
     }
 
     const uint32 NewHash = HashMaps(NewBone, NewCurve);
-    if (NewHash != CachedMapsHash)
+    if (NewHash != P.CachedMapsHash)
+    {
+        P.CachedMapsHash = NewHash;
+        bChanged = true;
+    }
+
+    if (!bChanged && P.bRemapPublished)
     {
-        CachedMapsHash = NewHash;
-        CachedBoneMap = MoveTemp(NewBone);
-        CachedCurveMap = MoveTemp(NewCurve);
-        bForceStaticNext = true; // names changed → republish once
+        return;
+    }
+
+    TSharedRef<FVMCRemapState, ESPMode::ThreadSafe> State = MakeShared<FVMCRemapState, ESPMode::ThreadSafe>();
+    State->BoneMap = MoveTemp(NewBone);
+    State->CurveMap = MoveTemp(NewCurve);
+    State->RefLocalTranslationByName = P.RefLocalTranslationByName;
+    State->bHaveRefOffsets = P.bHaveRefOffsets;
+
+    {
+        FScopeLock Lock(&P.RemapLock);
+        P.PendingRemap = State;
+        P.bRemapReady = true;
     }
+    P.bRemapPublished = true;
 }
 
-void FVMCLiveLinkSource::EnsureSubjectSettingsWithDefaults()
+// Assigning ULiveLinkSubjectSettings::Remapper from code fires no change notification outside
+// the editor; a once-a-second pointer compare catches it
+void FVMCLiveLinkSource::CheckSubjectRemappers()
 {
-    if (!Client || bEnsuredDefaults)
+    check(IsInGameThread());
+    if (!Client) return;
+
+    TArray<FVMCPerformer*, TInlineAllocator<4>> Changed;
+    {
+        FScopeLock Lock(&PerformersLock);
+        for (const TUniquePtr<FVMCPerformer>& P : Performers)
+        {
+            if (!P->bRemapPublished)
+            {
+                continue; // first frame builds it
+            }
+            const ULiveLinkSubjectSettings* Settings = Cast<ULiveLinkSubjectSettings>(Client->GetSubjectSettings({ SourceGuid, P->SubjectName }));
+            const ULiveLinkSubjectRemapper* NowRemapper = Settings ? Settings->Remapper.Get() : nullptr;
+            if (P->LastSeenRemapper.Get() != NowRemapper)
+            {
+                Changed.Add(P.Get());
+            }
+        }
+    }
+
+    // Outside the lock: the rebuild may load the reference mesh
+    for (FVMCPerformer* P : Changed)
+    {
+        RefreshStaticMapsFromSettings(*P);
+    }
+}
+
+void FVMCLiveLinkSource::EnsureSubjectSettingsWithDefaults(FVMCPerformer& P)
+{
+    if (!Client || P.bEnsuredDefaults)
         return;
 
     check(IsInGameThread());
 
-    const FLiveLinkSubjectKey Key{ SourceGuid, SubjectName };
+    const FLiveLinkSubjectKey Key{ SourceGuid, P.SubjectName };
 
     // Bootstrap the subject settings if they don't exist yet.
     FLiveLinkSubjectPreset Preset;
-    Preset.Key = FLiveLinkSubjectKey{ SourceGuid, SubjectName };
+    Preset.Key = FLiveLinkSubjectKey{ SourceGuid, P.SubjectName };
     Preset.Role = ULiveLinkAnimationRole::StaticClass();
 
     // Create a settings object we can hand to the client
@@ -564,11 +1613,8 @@ void FVMCLiveLinkSource::EnsureSubjectSettingsWithDefaults()
     Client->CreateSubject(Preset);
     Client->SetSubjectEnabled(Preset.Key, true);
 
-    // 3) Warm caches and make sure we publish remapped names once
-    RefreshStaticMapsFromSettings();
-    bForceStaticNext = true;
-    bEnsuredDefaults = true;
-
-    // If bones are already known, push now; otherwise this will early-out harmlessly
-    PushStaticData(/*bForce=*/true);
+    // 3) The caller rebuilds the remap caches from these settings next; make sure the new
+    //    names go out once. (Static data is pushed by the push step only; it owns the skeleton state.)
+    P.bForceStaticNext = true;
+    P.bEnsuredDefaults = true;
 }
@@ -90,20 +90,122 @@ static FString ParseSubject(const FString& Conn, FString DefaultSubject)
 	return Subject;
 }
 
+// Generic key lookup for the advanced options ("key=value;key=value")
+static FString ParseValue(const FString& Conn, const TCHAR* Key, const FString& DefaultValue)
+{
+	TArray<FString> Parts;
+	Conn.ParseIntoArray(Parts, TEXT(";"), true);
+	for (const FString& P : Parts)
+	{
+		FString K, V;
+		if (P.Split(TEXT("="), &K, &V) && K.Equals(Key, ESearchCase::IgnoreCase))
+		{
+			return V;
+		}
+	}
+	return DefaultValue;
+}
+
+static FVMCLiveLinkSourceOptions ParseOptions(const FString& Conn)
+{
+	FVMCLiveLinkSourceOptions Opt;
+
+	const FString Ingest = ParseValue(Conn, TEXT("ingest"), TEXT("osc"));
+	Opt.IngestMode = Ingest.Equals(TEXT("native"), ESearchCase::IgnoreCase) ? EVMCIngestMode::NativeUdp : EVMCIngestMode::OSCServer;
+	Opt.BindAddress = ParseValue(Conn, TEXT("bind"), Opt.BindAddress);
+
+	// record=<file>; replay=<file> (implies ingest=replay); replayspeed=realtime|max; replayloop=0|1
+	Opt.RecordPath = ParseValue(Conn, TEXT("record"), FString()).TrimStartAndEnd();
+	Opt.ReplayPath = ParseValue(Conn, TEXT("replay"), FString()).TrimStartAndEnd();
+	if (!Opt.ReplayPath.IsEmpty())
+	{
+		Opt.IngestMode = EVMCIngestMode::Replay;
+	}
+	Opt.bReplayRealtime = !ParseValue(Conn, TEXT("replayspeed"), TEXT("realtime")).Equals(TEXT("max"), ESearchCase::IgnoreCase);
+	Opt.bReplayLoop = FCString::Atoi(*ParseValue(Conn, TEXT("replayloop"), TEXT("0"))) == 1;
+
+	// multicast=<group>; mcastif=<interface ip>
+	Opt.Multicast.Group = ParseValue(Conn, TEXT("multicast"), FString()).TrimStartAndEnd();
+	Opt.Multicast.Interface = ParseValue(Conn, TEXT("mcastif"), Opt.Multicast.Interface);
+
+	const FString Commit = ParseValue(Conn, TEXT("commit"), TEXT("apply"));
+	Opt.CommitMode = Commit.Equals(TEXT("bundle"), ESearchCase::IgnoreCase) ? EVMCFrameCommit::OnBundle : EVMCFrameCommit::OnApply;
+	Opt.bUseSenderTime = FCString::Atoi(*ParseValue(Conn, TEXT("sendertime"), TEXT("0"))) == 1;
+
+	// skeleton=stream|humanoid
+	Opt.bHumanoidSkeleton = ParseValue(Conn, TEXT("skeleton"), TEXT("stream")).Equals(TEXT("humanoid"), ESearchCase::IgnoreCase);
+
+	Opt.JitterTargetMs = FCString::Atof(*ParseValue(Conn, TEXT("jitter"), TEXT("0")));
+	Opt.JitterMaxMs = FCString::Atof(*ParseValue(Conn, TEXT("jittermax"), TEXT("50")));
+	Opt.bJitterAdaptive = FCString::Atoi(*ParseValue(Conn, TEXT("jitteradapt"), TEXT("1"))) == 1;
+
+	// output=pass|rate|tick; outputhz=<Hz> (rate)
+	const FString Output = ParseValue(Conn, TEXT("output"), TEXT("pass"));
+	Opt.OutputPolicy = Output.Equals(TEXT("rate"), ESearchCase::IgnoreCase) ? EVMCOutputPolicy::FixedRate
+		: Output.Equals(TEXT("tick"), ESearchCase::IgnoreCase) ? EVMCOutputPolicy::PerEngineTick
+		: EVMCOutputPolicy::PassThrough;
+	Opt.OutputRateHz = FCString::Atof(*ParseValue(Conn, TEXT("outputhz"), TEXT("60")));
+
+	// conceal=<ms> (0 = off); concealblend=<ms>
+	Opt.ConcealMaxMs = FCString::Atof(*ParseValue(Conn, TEXT("conceal"), TEXT("0")));
+	Opt.ConcealBlendMs = FCString::Atof(*ParseValue(Conn, TEXT("concealblend"), TEXT("150")));
+
+	// deadband=0|1; deadbandrot=<deg>; deadbandpos=<cm>; deadbandcurve=<value>; heartbeat=<ms>
+	Opt.bDeadband = FCString::Atoi(*ParseValue(Conn, TEXT("deadband"), TEXT("0"))) == 1;
+	Opt.DeadbandRotationDeg = FCString::Atof(*ParseValue(Conn, TEXT("deadbandrot"), TEXT("0.05")));
+	Opt.DeadbandTranslationCm = FCString::Atof(*ParseValue(Conn, TEXT("deadbandpos"), TEXT("0.01")));
+	Opt.DeadbandCurve = FCString::Atof(*ParseValue(Conn, TEXT("deadbandcurve"), TEXT("0.001")));
+	Opt.DeadbandHeartbeatMs = FCString::Atof(*ParseValue(Conn, TEXT("heartbeat"), TEXT("250")));
+
+	// demux=none|endpoint|ip; performers=ip[:port]=Subject,ip[:port]=Subject
+	const FString Demux = ParseValue(Conn, TEXT("demux"), TEXT("none"));
+	Opt.DemuxMode = Demux.Equals(TEXT("endpoint"), ESearchCase::IgnoreCase) ? EVMCDemuxMode::SenderEndpoint
+		: Demux.Equals(TEXT("ip"), ESearchCase::IgnoreCase) ? EVMCDemuxMode::SenderAddress
+		: EVMCDemuxMode::None;
+
+	TArray<FString> Rules;
+	ParseValue(Conn, TEXT("performers"), FString()).ParseIntoArray(Rules, TEXT(","), true);
+	for (const FString& R : Rules)
+	{
+		FString Endpoint, Name;
+		if (!R.Split(TEXT("="), &Endpoint, &Name) || Name.TrimStartAndEnd().IsEmpty())
+		{
+			continue;
+		}
+		FVMCPerformerRule& Rule = Opt.PerformerRules.AddDefaulted_GetRef();
+		FString Ip, Port;
+		if (Endpoint.Split(TEXT(":"), &Ip, &Port))
+		{
+			Rule.Address = Ip.TrimStartAndEnd();
+			Rule.Port = FCString::Atoi(*Port);
+		}
+		else
+		{
+			Rule.Address = Endpoint.TrimStartAndEnd();
+		}
+		Rule.SubjectName = FName(*Name.TrimStartAndEnd());
+	}
+	Opt.bOnlyListedPerformers = FCString::Atoi(*ParseValue(Conn, TEXT("listedonly"), TEXT("0"))) == 1;
+	Opt.MaxPerformers = FCString::Atoi(*ParseValue(Conn, TEXT("maxperformers"), TEXT("16")));
+
+	return Opt;
+}
+
 TSharedPtr<ILiveLinkSource> UVMCLiveLinkSourceFactory::CreateSource(const FString& ConnectionString) const
 {
 	const int32 Port = ParsePort(ConnectionString, 39539);
 	const bool UnityToUnreal = ParseUnityToUnreal(ConnectionString, true);
 	const bool MetersToCm = ParseMetersToCm(ConnectionString, true);
 	const FString Subject = ParseSubject(ConnectionString, TEXT("VMC_Subject"));
+	const FVMCLiveLinkSourceOptions Options = ParseOptions(ConnectionString);
 
-	return MakeShared<FVMCLiveLinkSource>(TEXT("VMC"), Port, UnityToUnreal, MetersToCm, 0, Subject);
+	return MakeShared<FVMCLiveLinkSource>(TEXT("VMC"), Port, UnityToUnreal, MetersToCm, 0, Subject, Options);
 }
 
 #if WITH_EDITOR
 TSharedPtr<SWidget> UVMCLiveLinkSourceFactory::BuildCreationPanel(FOnLiveLinkSourceCreated OnCreated) const
 {
-	struct FState { int32 Port = 39539; bool bUnityToUE = true; bool bMetersToCm = true; FString SubjectName = FString(TEXT("VMC_Subject")); };
+	struct FState { int32 Port = 39539; bool bUnityToUE = true; bool bMetersToCm = true; bool bNativeIngest = false; bool bCommitOnBundle = false; int32 JitterMs = 0; bool bDemux = false; int32 OutputHz = 0; int32 ConcealMs = 0; bool bDeadband = false; FString SubjectName = FString(TEXT("VMC_Subject")); };
 
 	TSharedRef<FState> State = MakeShared<FState>();
 
@@ -116,10 +218,13 @@ TSharedPtr<SWidget> UVMCLiveLinkSourceFactory::BuildCreationPanel(FOnLiveLinkSou
 			return;
 		}
 
-		const FString Conn = FString::Printf(TEXT("port=%d;unity2ue=%d;meters2cm=%d;subject=%s"),
-			State->Port, State->bUnityToUE ? 1 : 0, State->bMetersToCm ? 1 : 0, *State->SubjectName);
+		const FString Conn = FString::Printf(TEXT("port=%d;unity2ue=%d;meters2cm=%d;subject=%s;ingest=%s;commit=%s;jitter=%d;demux=%s;output=%s;outputhz=%d;conceal=%d;deadband=%d"),
+			State->Port, State->bUnityToUE ? 1 : 0, State->bMetersToCm ? 1 : 0, *State->SubjectName,
+			State->bNativeIngest ? TEXT("native") : TEXT("osc"), State->bCommitOnBundle ? TEXT("bundle") : TEXT("apply"),
+			State->JitterMs, State->bDemux ? TEXT("endpoint") : TEXT("none"),
+			State->OutputHz > 0 ? TEXT("rate") : TEXT("pass"), State->OutputHz > 0 ? State->OutputHz : 60, State->ConcealMs, State->bDeadband ? 1 : 0);
 
-		const TSharedPtr<ILiveLinkSource> Src = MakeShared<FVMCLiveLinkSource>(TEXT("VMC"), State->Port, State->bUnityToUE, State->bMetersToCm, 0.0f, State->SubjectName);
+		const TSharedPtr<ILiveLinkSource> Src = MakeShared<FVMCLiveLinkSource>(TEXT("VMC"), State->Port, State->bUnityToUE, State->bMetersToCm, 0.0f, State->SubjectName, ParseOptions(Conn));
 		if (OnCreated.IsBound())
 		{
 			OnCreated.Execute(Src, Conn);
@@ -202,6 +307,88 @@ TSharedPtr<SWidget> UVMCLiveLinkSourceFactory::BuildCreationPanel(FOnLiveLinkSou
 						]
 				]
 		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SCheckBox)
+				.ToolTipText(NSLOCTEXT("VMCLiveLink", "NativeIngestTip", "Read the socket on a dedicated thread and decode OSC in place (bypasses the OSC plugin server)"))
+				.IsChecked_Lambda([State] { return State->bNativeIngest ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged_Lambda([State](ECheckBoxState S) { State->bNativeIngest = (S == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock).Text(NSLOCTEXT("VMCLiveLink", "NativeIngest", "Native UDP ingest"))
+				]
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SCheckBox)
+				.ToolTipText(NSLOCTEXT("VMCLiveLink", "CommitOnBundleTip", "Publish a frame at the end of every OSC bundle instead of waiting for /VMC/Ext/Blend/Apply"))
+				.IsChecked_Lambda([State] { return State->bCommitOnBundle ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged_Lambda([State](ECheckBoxState S) { State->bCommitOnBundle = (S == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock).Text(NSLOCTEXT("VMCLiveLink", "CommitOnBundle", "Commit frame per bundle"))
+				]
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SCheckBox)
+				.ToolTipText(NSLOCTEXT("VMCLiveLink", "DemuxTip", "Create one subject per sender IP:port on this port (Subject_<ip>_<port>)"))
+				.IsChecked_Lambda([State] { return State->bDemux ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged_Lambda([State](ECheckBoxState S) { State->bDemux = (S == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock).Text(NSLOCTEXT("VMCLiveLink", "Demux", "One subject per sender"))
+				]
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SCheckBox)
+				.ToolTipText(NSLOCTEXT("VMCLiveLink", "DeadbandTip", "Don't push frames that match the last one within a small tolerance (a heartbeat still goes out every 250 ms). Saves evaluation work for idle avatars."))
+				.IsChecked_Lambda([State] { return State->bDeadband ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged_Lambda([State](ECheckBoxState S) { State->bDeadband = (S == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock).Text(NSLOCTEXT("VMCLiveLink", "Deadband", "Skip unchanged frames"))
+				]
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(0, 0, 8, 0)
+				[SNew(STextBlock).Text(NSLOCTEXT("VMCLiveLink", "JitterMs", "Jitter buffer (ms, 0 = off)"))]
+				+ SHorizontalBox::Slot().AutoWidth()
+				[
+					SNew(SSpinBox<int32>)
+						.MinValue(0).MaxValue(200)
+						.ToolTipText(NSLOCTEXT("VMCLiveLink", "JitterMsTip", "Target playout latency. Frames are held this long (more if arrival jitter is higher) and pushed at an even pace."))
+						.Value_Lambda([State] { return State->JitterMs; })
+						.OnValueChanged_Lambda([State](int32 V) { State->JitterMs = V; })
+				]
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(0, 0, 8, 0)
+				[SNew(STextBlock).Text(NSLOCTEXT("VMCLiveLink", "OutputHz", "Max output rate (Hz, 0 = every frame)"))]
+				+ SHorizontalBox::Slot().AutoWidth()
+				[
+					SNew(SSpinBox<int32>)
+						.MinValue(0).MaxValue(480)
+						.ToolTipText(NSLOCTEXT("VMCLiveLink", "OutputHzTip", "Push at most this many frames per second to Live Link; faster senders are still decoded in full and the newest frame wins."))
+						.Value_Lambda([State] { return State->OutputHz; })
+						.OnValueChanged_Lambda([State](int32 V) { State->OutputHz = V; })
+				]
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(0, 0, 8, 0)
+				[SNew(STextBlock).Text(NSLOCTEXT("VMCLiveLink", "ConcealMs", "Conceal packet loss (ms, 0 = off)"))]
+				+ SHorizontalBox::Slot().AutoWidth()
+				[
+					SNew(SSpinBox<int32>)
+						.MinValue(0).MaxValue(500)
+						.ToolTipText(NSLOCTEXT("VMCLiveLink", "ConcealMsTip", "When frames stop arriving, keep the pose moving along its recent velocity for up to this long, then blend back once data resumes."))
+						.Value_Lambda([State] { return State->ConcealMs; })
+						.OnValueChanged_Lambda([State](int32 V) { State->ConcealMs = V; })
+				]
+		]
 		+ SVerticalBox::Slot().AutoHeight().HAlign(HAlign_Right).Padding(4)
 		[
 			SNew(SUniformGridPanel).SlotPadding(FMargin(4))
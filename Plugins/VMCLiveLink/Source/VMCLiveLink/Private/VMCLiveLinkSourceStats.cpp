@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCLiveLinkSourceStats.h"
+
+int32 FVMCLiveLinkSourceStats::LatencyBucket(double Microseconds)
+{
+    if (Microseconds < 32.0)
+    {
+        return 0;
+    }
+    const uint64 Units = (uint64)(Microseconds / 32.0);
+    return FMath::Min((int32)FMath::FloorLog2_64(Units) + 1, NumLatencyBuckets - 1);
+}
+
+double FVMCLiveLinkSourceStats::LatencyBucketUpperUs(int32 Bucket)
+{
+    return 32.0 * (double)(1ull << FMath::Clamp(Bucket, 0, NumLatencyBuckets - 1));
+}
+
+static double HistogramPercentileUs(const uint64* Histogram, double Percentile)
+{
+    uint64 Total = 0;
+    for (int32 i = 0; i < FVMCLiveLinkSourceStats::NumLatencyBuckets; ++i)
+    {
+        Total += Histogram[i];
+    }
+    if (Total == 0)
+    {
+        return 0.0;
+    }
+
+    const uint64 Rank = FMath::Max<uint64>(1, (uint64)FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0, 1.0) * Total));
+    uint64 Seen = 0;
+    for (int32 i = 0; i < FVMCLiveLinkSourceStats::NumLatencyBuckets; ++i)
+    {
+        Seen += Histogram[i];
+        if (Seen >= Rank)
+        {
+            return FVMCLiveLinkSourceStats::LatencyBucketUpperUs(i);
+        }
+    }
+    return FVMCLiveLinkSourceStats::LatencyBucketUpperUs(FVMCLiveLinkSourceStats::NumLatencyBuckets - 1);
+}
+
+double FVMCLiveLinkSourceStats::LatencyPercentileUs(double Percentile) const
+{
+    return HistogramPercentileUs(Latency, Percentile);
+}
+
+double FVMCLiveLinkSourceStats::ApplyLatencyPercentileUs(double Percentile) const
+{
+    return HistogramPercentileUs(ApplyLatency, Percentile);
+}
+
+FVMCLiveLinkSourceStats FVMCLiveLinkSourceStats::operator-(const FVMCLiveLinkSourceStats& Earlier) const
+{
+    FVMCLiveLinkSourceStats D = *this;
+    D.Datagrams -= Earlier.Datagrams;
+    D.Messages -= Earlier.Messages;
+    D.Malformed -= Earlier.Malformed;
+    D.Rejected -= Earlier.Rejected;
+    D.BadMessages -= Earlier.BadMessages;
+    D.UnknownAddresses -= Earlier.UnknownAddresses;
+    D.Committed -= Earlier.Committed;
+    D.Pushed -= Earlier.Pushed;
+    D.Coalesced -= Earlier.Coalesced;
+    D.Suppressed -= Earlier.Suppressed;
+    D.Dropped -= Earlier.Dropped;
+    D.StaticPushes -= Earlier.StaticPushes;
+    D.IngestSeconds -= Earlier.IngestSeconds;
+    D.PushSeconds -= Earlier.PushSeconds;
+    for (int32 i = 0; i < NumLatencyBuckets; ++i)
+    {
+        D.Latency[i] -= Earlier.Latency[i];
+        D.ApplyLatency[i] -= Earlier.ApplyLatency[i];
+    }
+    return D;
+}
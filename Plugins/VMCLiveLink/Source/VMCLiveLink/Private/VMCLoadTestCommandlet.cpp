@@ -0,0 +1,371 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCLoadTestCommandlet.h"
+#include "VMCLog.h"
+#include "VMCLiveLinkSource.h"
+#include "VMCHumanoidSchema.h"
+
+#include "ILiveLinkClient.h"
+#include "Features/IModularFeatures.h"
+#include "Modules/ModuleManager.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "HAL/MemoryBase.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+#include "Common/UdpSocketBuilder.h"
+
+namespace
+{
+    // Largest bundle the synthetic sender builds before starting another datagram
+    constexpr int32 MaxBundleBytes = 60 * 1024;
+
+    // Minimal OSC writer (big-endian, 4-byte aligned); buffers are reused across frames
+    struct FOscWriter
+    {
+        TArray<uint8> Data;
+
+        void Pad() { while (Data.Num() & 3) Data.Add(0); }
+        void Str(const ANSICHAR* S) { Data.Append((const uint8*)S, FCStringAnsi::Strlen(S)); Data.Add(0); Pad(); }
+        void U32(uint32 V) { const uint8 B[4] = { uint8(V >> 24), uint8(V >> 16), uint8(V >> 8), uint8(V) }; Data.Append(B, 4); }
+        void F32(float F) { uint32 V; FMemory::Memcpy(&V, &F, 4); U32(V); }
+    };
+
+    // NUL-terminated ASCII copy of a name (the writer takes C strings)
+    TArray<ANSICHAR> ToAnsi(const FString& S)
+    {
+        const auto Conv = StringCast<ANSICHAR>(*S);
+        return TArray<ANSICHAR>(Conv.Get(), Conv.Length() + 1);
+    }
+
+    // One synthetic sender: its socket, names and bundle scratch
+    struct FSyntheticPerformer
+    {
+        FSocket* Socket = nullptr;
+        TArray<TArray<ANSICHAR>> Bones;
+        TArray<TArray<ANSICHAR>> Curves;
+        FOscWriter Bundle;
+        FOscWriter Msg;
+    };
+
+    class FSyntheticSender
+    {
+    public:
+        FSyntheticSender(int32 InNumPerformers, int32 NumBones, int32 NumCurves, int32 Port)
+        {
+            ISocketSubsystem* Subsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+            Target = Subsystem->CreateInternetAddr();
+            Target->SetIp(FIPv4Address(127, 0, 0, 1).Value);
+            Target->SetPort(Port);
+
+            Performers.SetNum(InNumPerformers);
+            for (FSyntheticPerformer& P : Performers)
+            {
+                // Ephemeral source port per performer, so endpoint demux tells them apart
+                P.Socket = FUdpSocketBuilder(TEXT("VMCLoadTestSender"))
+                    .BoundToAddress(FIPv4Address(127, 0, 0, 1))
+                    .BoundToPort(0)
+                    .WithSendBufferSize(4 * 1024 * 1024)
+                    .Build();
+
+                for (int32 b = 0; b < NumBones; ++b)
+                {
+                    P.Bones.Add(ToAnsi(b + 1 < VMCHumanoidSchema::NumBones
+                        ? FString(UTF8_TO_TCHAR(VMCHumanoidSchema::Bones[b + 1].Name))   // skip the synthesized root
+                        : FString::Printf(TEXT("Extra%d"), b)));
+                }
+                for (int32 c = 0; c < NumCurves; ++c)
+                {
+                    P.Curves.Add(ToAnsi(FString::Printf(TEXT("BlendShape%02d"), c)));
+                }
+            }
+        }
+
+        ~FSyntheticSender()
+        {
+            for (FSyntheticPerformer& P : Performers)
+            {
+                if (P.Socket)
+                {
+                    P.Socket->Close();
+                    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(P.Socket);
+                }
+            }
+        }
+
+        bool IsValid() const
+        {
+            return !Performers.ContainsByPredicate([](const FSyntheticPerformer& P) { return P.Socket == nullptr; });
+        }
+
+        // One VMC frame per performer: root, bones, blendshapes, Apply (split into bundles as needed)
+        void SendFrame(double Time)
+        {
+            for (int32 p = 0; p < Performers.Num(); ++p)
+            {
+                FSyntheticPerformer& P = Performers[p];
+                BeginBundle(P);
+
+                const float Phase = (float)Time * 2.f + p;
+                AddPose(P, "/VMC/Ext/Root/Pos", "root", Phase, 0.f);
+                for (int32 b = 0; b < P.Bones.Num(); ++b)
+                {
+                    AddPose(P, "/VMC/Ext/Bone/Pos", P.Bones[b].GetData(), Phase, (float)b);
+                }
+                for (int32 c = 0; c < P.Curves.Num(); ++c)
+                {
+                    P.Msg.Data.Reset();
+                    P.Msg.Str("/VMC/Ext/Blend/Val");
+                    P.Msg.Str(",sf");
+                    P.Msg.Str(P.Curves[c].GetData());
+                    P.Msg.F32(0.5f + 0.5f * FMath::Sin(Phase + c * 0.1f));
+                    AddMessage(P);
+                }
+                P.Msg.Data.Reset();
+                P.Msg.Str("/VMC/Ext/Blend/Apply");
+                P.Msg.Str(",");
+                AddMessage(P);
+
+                Flush(P);
+            }
+        }
+
+        uint64 MessagesSent = 0;
+        uint64 DatagramsSent = 0;
+        uint64 SendFailures = 0;
+
+    private:
+        void BeginBundle(FSyntheticPerformer& P)
+        {
+            P.Bundle.Data.Reset();
+            P.Bundle.Str("#bundle");
+            P.Bundle.U32(0);
+            P.Bundle.U32(1);   // timetag "immediately"
+        }
+
+        void AddPose(FSyntheticPerformer& P, const ANSICHAR* Address, const ANSICHAR* Name, float Phase, float Index)
+        {
+            const FQuat Q(FRotator(10.f * FMath::Sin(Phase + Index), 10.f * FMath::Cos(Phase + Index), 0.f));
+            P.Msg.Data.Reset();
+            P.Msg.Str(Address);
+            P.Msg.Str(",sfffffff");
+            P.Msg.Str(Name);
+            P.Msg.F32(0.01f * Index);
+            P.Msg.F32(1.f + 0.05f * FMath::Sin(Phase));
+            P.Msg.F32(0.f);
+            P.Msg.F32((float)Q.X);
+            P.Msg.F32((float)Q.Y);
+            P.Msg.F32((float)Q.Z);
+            P.Msg.F32((float)Q.W);
+            AddMessage(P);
+        }
+
+        void AddMessage(FSyntheticPerformer& P)
+        {
+            if (P.Bundle.Data.Num() + 4 + P.Msg.Data.Num() > MaxBundleBytes)
+            {
+                Flush(P);
+                BeginBundle(P);
+            }
+            P.Bundle.U32((uint32)P.Msg.Data.Num());
+            P.Bundle.Data.Append(P.Msg.Data);
+            ++MessagesSent;
+        }
+
+        void Flush(FSyntheticPerformer& P)
+        {
+            if (P.Bundle.Data.Num() <= 16)
+            {
+                return; // header only
+            }
+            int32 Sent = 0;
+            if (P.Socket->SendTo(P.Bundle.Data.GetData(), P.Bundle.Data.Num(), Sent, *Target))
+            {
+                ++DatagramsSent;
+            }
+            else
+            {
+                ++SendFailures;
+            }
+        }
+
+        TArray<FSyntheticPerformer> Performers;
+        TSharedPtr<FInternetAddr> Target;
+    };
+
+    uint64 GetMallocCalls()
+    {
+        // Counted by allocators that track it (non-shipping); process-wide
+#if !UE_BUILD_SHIPPING
+        return FMalloc::TotalMallocCalls.load(std::memory_order_relaxed) + FMalloc::TotalReallocCalls.load(std::memory_order_relaxed);
+#else
+        return 0;
+#endif
+    }
+
+    void PumpGameThread(float DeltaTime)
+    {
+        // Settings bootstrap/refresh tasks, Live Link client and the source's own ticks
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FTSTicker::GetCoreTicker().Tick(DeltaTime);
+    }
+}
+
+UVMCLoadTestCommandlet::UVMCLoadTestCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UVMCLoadTestCommandlet::Main(const FString& Params)
+{
+    int32 NumPerformers = 4, NumBones = 55, NumCurves = 52, Port = 39600;
+    float Rate = 60.f, Seconds = 10.f, Warmup = 2.f;
+    FParse::Value(*Params, TEXT("performers="), NumPerformers);
+    FParse::Value(*Params, TEXT("bones="), NumBones);
+    FParse::Value(*Params, TEXT("blendshapes="), NumCurves);
+    FParse::Value(*Params, TEXT("port="), Port);
+    FParse::Value(*Params, TEXT("rate="), Rate);
+    FParse::Value(*Params, TEXT("seconds="), Seconds);
+    FParse::Value(*Params, TEXT("warmup="), Warmup);
+    NumPerformers = FMath::Max(NumPerformers, 1);
+    Rate = FMath::Max(Rate, 1.f);
+
+    FVMCLiveLinkSourceOptions Options;
+    FString Value;
+    if (FParse::Value(*Params, TEXT("ingest="), Value))
+    {
+        Options.IngestMode = Value.Equals(TEXT("osc"), ESearchCase::IgnoreCase) ? EVMCIngestMode::OSCServer : EVMCIngestMode::NativeUdp;
+    }
+    else
+    {
+        Options.IngestMode = EVMCIngestMode::NativeUdp;
+    }
+    if (FParse::Value(*Params, TEXT("commit="), Value))
+    {
+        Options.CommitMode = Value.Equals(TEXT("bundle"), ESearchCase::IgnoreCase) ? EVMCFrameCommit::OnBundle : EVMCFrameCommit::OnApply;
+    }
+    if (FParse::Value(*Params, TEXT("output="), Value))
+    {
+        Options.OutputPolicy = Value.Equals(TEXT("rate"), ESearchCase::IgnoreCase) ? EVMCOutputPolicy::FixedRate
+            : Value.Equals(TEXT("tick"), ESearchCase::IgnoreCase) ? EVMCOutputPolicy::PerEngineTick
+            : EVMCOutputPolicy::PassThrough;
+    }
+    FParse::Value(*Params, TEXT("outputhz="), Options.OutputRateHz);
+    FParse::Value(*Params, TEXT("jitter="), Options.JitterTargetMs);
+    Options.bDeadband = FParse::Param(*Params, TEXT("deadband"));
+    Options.DemuxMode = NumPerformers > 1 ? EVMCDemuxMode::SenderEndpoint : EVMCDemuxMode::None;
+    Options.MaxPerformers = NumPerformers;
+
+    FModuleManager::Get().LoadModule(TEXT("LiveLink"));
+    if (!IModularFeatures::Get().IsModularFeatureAvailable(ILiveLinkClient::ModularFeatureName))
+    {
+        UE_LOG(LogVMCLiveLink, Error, TEXT("VMCLoadTest: Live Link client not available"));
+        return 1;
+    }
+    ILiveLinkClient& Client = IModularFeatures::Get().GetModularFeature<ILiveLinkClient>(ILiveLinkClient::ModularFeatureName);
+
+    TSharedPtr<FVMCLiveLinkSource> Source = MakeShared<FVMCLiveLinkSource>(TEXT("VMCLoadTest"), Port, true, true, 0.f, TEXT("VMC_Load"), Options);
+    const FGuid SourceGuid = Client.AddSource(Source);
+    if (!Source->IsSourceStillValid())
+    {
+        UE_LOG(LogVMCLiveLink, Error, TEXT("VMCLoadTest: source could not listen on port %d"), Port);
+        Client.RemoveSource(SourceGuid);
+        return 1;
+    }
+
+    FSyntheticSender Sender(NumPerformers, NumBones, NumCurves, Port);
+    if (!Sender.IsValid())
+    {
+        UE_LOG(LogVMCLiveLink, Error, TEXT("VMCLoadTest: could not create sender sockets"));
+        Client.RemoveSource(SourceGuid);
+        return 1;
+    }
+
+    UE_LOG(LogVMCLiveLink, Display, TEXT("VMCLoadTest: %d performer(s) x %d bones x %d blendshapes at %.1f Hz for %.1fs (+%.1fs warm-up) on port %d"),
+        NumPerformers, NumBones, NumCurves, Rate, Seconds, Warmup, Port);
+
+    // Send on a fixed grid; between frames run the game-thread work the source depends on
+    const double Interval = 1.0 / Rate;
+    const double Start = FPlatformTime::Seconds();
+    const double MeasureFrom = Start + Warmup;
+    const double End = MeasureFrom + Seconds;
+    double Next = Start;
+    double LastPump = Start;
+    uint64 Late = 0;
+
+    bool bMeasuring = false;
+    FVMCLiveLinkSourceStats Before;
+    uint64 MallocBefore = 0, SentBefore = 0;
+    double MeasureStart = 0.0;
+
+    for (double Now = Start; Now < End; Now = FPlatformTime::Seconds())
+    {
+        if (!bMeasuring && Now >= MeasureFrom)
+        {
+            Source->GetStats(Before);
+            MallocBefore = GetMallocCalls();
+            SentBefore = Sender.MessagesSent;
+            MeasureStart = Now;
+            bMeasuring = true;
+        }
+
+        if (Now >= Next)
+        {
+            Sender.SendFrame(Now - Start);
+            Next += Interval;
+            if (Next <= Now)
+            {
+                ++Late;   // sender can't keep up; re-anchor instead of bursting
+                Next = Now + Interval;
+            }
+        }
+
+        PumpGameThread((float)(Now - LastPump));
+        LastPump = Now;
+
+        const double Wait = Next - FPlatformTime::Seconds();
+        if (Wait > 0.002)
+        {
+            FPlatformProcess::SleepNoStats((float)(Wait - 0.001));
+        }
+    }
+
+    // Let in-flight datagrams and playout drain before the final read
+    const double MeasureEnd = FPlatformTime::Seconds();
+    for (double Drain = MeasureEnd + 0.25, Now = MeasureEnd; Now < Drain; Now = FPlatformTime::Seconds())
+    {
+        PumpGameThread(0.01f);
+        FPlatformProcess::SleepNoStats(0.01f);
+    }
+
+    FVMCLiveLinkSourceStats After;
+    Source->GetStats(After);
+    const uint64 Mallocs = GetMallocCalls() - MallocBefore;
+    const FVMCLiveLinkSourceStats D = After - Before;
+    const double Window = FMath::Max(MeasureEnd - MeasureStart, 1e-6);
+    const uint64 Sent = Sender.MessagesSent - SentBefore;
+
+    // Pushes made inline on the ingest thread are already inside IngestSeconds
+    const bool bPushOnIngest = Options.JitterTargetMs <= 0.f && Options.OutputPolicy != EVMCOutputPolicy::PerEngineTick;
+    const double CpuSeconds = D.IngestSeconds + (bPushOnIngest ? 0.0 : D.PushSeconds);
+    const double PerFrame = D.Committed > 0 ? 1.0 / D.Committed : 0.0;
+
+    UE_LOG(LogVMCLiveLink, Display, TEXT("VMCLoadTest results over %.2fs (%d performer(s) seen):"), Window, After.NumPerformers);
+    UE_LOG(LogVMCLiveLink, Display, TEXT("  messages: sent %.0f/s, handled %.0f/s (%llu datagrams, %llu send failures, %llu late sender frames)"),
+        Sent / Window, D.Messages / Window, D.Datagrams, Sender.SendFailures, Late);
+    UE_LOG(LogVMCLiveLink, Display, TEXT("  frames: committed %llu (%.1f/s), pushed %llu, coalesced %llu, suppressed %llu"),
+        D.Committed, D.Committed / Window, D.Pushed, D.Coalesced, D.Suppressed);
+    UE_LOG(LogVMCLiveLink, Display, TEXT("  cpu per frame: %.2f us (ingest %.2f us, push %.2f us)"),
+        CpuSeconds * PerFrame * 1e6, D.IngestSeconds * PerFrame * 1e6, D.PushSeconds * PerFrame * 1e6);
+    UE_LOG(LogVMCLiveLink, Display, TEXT("  allocations per frame: %.2f (process-wide, includes the synthetic sender)"),
+        Mallocs * PerFrame);
+    UE_LOG(LogVMCLiveLink, Display, TEXT("  ingest->push latency (bucket upper bound): p50 <= %.0f us, p90 <= %.0f us, p99 <= %.0f us, max <= %.0f us"),
+        D.LatencyPercentileUs(0.5), D.LatencyPercentileUs(0.9), D.LatencyPercentileUs(0.99), D.LatencyPercentileUs(1.0));
+
+    Client.RemoveSource(SourceGuid);
+    PumpGameThread(0.f);
+    return 0;
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCNameTable.h"
+
+static constexpr int32 InitialBuckets = 128; // fits a full humanoid + ARKit curve set without rehashing
+
+// Names match the way FName compares them: ASCII case is ignored, so "hips" and "Hips" share a
+// slot (and its FName) instead of putting two equal FNames into the static data
+static FORCEINLINE uint8 FoldCase(UTF8CHAR C)
+{
+    const uint8 B = (uint8)C;
+    return (B >= 'A' && B <= 'Z') ? uint8(B | 0x20) : B;
+}
+
+static uint32 HashFolded(FUtf8StringView Name)
+{
+    uint32 H = 2166136261u;
+    for (UTF8CHAR C : Name)
+    {
+        H = (H ^ FoldCase(C)) * 16777619u;
+    }
+    return H;
+}
+
+static bool EqualsFolded(const UTF8CHAR* A, const UTF8CHAR* B, int32 Len)
+{
+    for (int32 i = 0; i < Len; ++i)
+    {
+        if (A[i] != B[i] && FoldCase(A[i]) != FoldCase(B[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FVMCNameTable::FVMCNameTable()
+{
+    Reset();
+}
+
+void FVMCNameTable::Reset()
+{
+    Entries.Reset();
+    Names.Reset();
+    Bytes.Reset();
+    Buckets.Init(INDEX_NONE, InitialBuckets);
+}
+
+int32 FVMCNameTable::FindSlot(FUtf8StringView Name, uint32 Hash) const
+{
+    const int32 Mask = Buckets.Num() - 1;
+    for (int32 b = Hash & Mask; Buckets[b] != INDEX_NONE; b = (b + 1) & Mask)
+    {
+        const int32 Slot = Buckets[b];
+        const FEntry& E = Entries[Slot];
+        if (E.Hash == Hash && E.Len == Name.Len() && EqualsFolded(Bytes.GetData() + E.Offset, Name.GetData(), E.Len))
+        {
+            return Slot;
+        }
+    }
+    return INDEX_NONE;
+}
+
+int32 FVMCNameTable::Find(FUtf8StringView Name) const
+{
+    return FindSlot(Name, HashFolded(Name));
+}
+
+int32 FVMCNameTable::FindOrAdd(FUtf8StringView Name, bool& bOutAdded)
+{
+    const uint32 Hash = HashFolded(Name);
+    const int32 Existing = FindSlot(Name, Hash);
+    if (Existing != INDEX_NONE)
+    {
+        bOutAdded = false;
+        return Existing;
+    }
+
+    // Keep load factor <= 1/2
+    if ((Entries.Num() + 1) * 2 > Buckets.Num())
+    {
+        Rehash(Buckets.Num() * 2);
+    }
+
+    const int32 Slot = Entries.Add({ Hash, Bytes.Num(), Name.Len() });
+    Bytes.Append(Name.GetData(), Name.Len());
+    Names.Add(FName(Name.Len(), Name.GetData()));
+
+    const int32 Mask = Buckets.Num() - 1;
+    int32 b = Hash & Mask;
+    while (Buckets[b] != INDEX_NONE)
+    {
+        b = (b + 1) & Mask;
+    }
+    Buckets[b] = Slot;
+
+    bOutAdded = true;
+    return Slot;
+}
+
+void FVMCNameTable::Rehash(int32 NewBucketCount)
+{
+    Buckets.Init(INDEX_NONE, NewBucketCount);
+    const int32 Mask = NewBucketCount - 1;
+    for (int32 Slot = 0; Slot < Entries.Num(); ++Slot)
+    {
+        int32 b = Entries[Slot].Hash & Mask;
+        while (Buckets[b] != INDEX_NONE)
+        {
+            b = (b + 1) & Mask;
+        }
+        Buckets[b] = Slot;
+    }
+}
@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Intern table mapping raw OSC name bytes (UTF-8, as they sit in the datagram) to stable dense slots.
+ * The FName for a slot is built once, when the name is first seen; after that a lookup is one
+ * byte hash + a probe + a compare. Names that differ only in ASCII case share a slot, as they
+ * would as FNames. Slots are never removed or reordered (Reset() clears everything).
+ * Not thread-safe: owned by the receive thread.
+ */
+class FVMCNameTable
+{
+public:
+    FVMCNameTable();
+
+    // Slot for Name, or INDEX_NONE
+    int32 Find(FUtf8StringView Name) const;
+
+    // Slot for Name, adding it (and building its FName) on first sight
+    int32 FindOrAdd(FUtf8StringView Name, bool& bOutAdded);
+
+    int32 Num() const { return Names.Num(); }
+    FName GetName(int32 Slot) const { return Names[Slot]; }
+    const TArray<FName>& GetNames() const { return Names; }
+
+    void Reset();
+
+private:
+    struct FEntry
+    {
+        uint32 Hash;
+        int32 Offset; // into Bytes
+        int32 Len;
+    };
+
+    int32 FindSlot(FUtf8StringView Name, uint32 Hash) const;
+    void Rehash(int32 NewBucketCount);
+
+    TArray<FEntry> Entries;   // slot → bytes
+    TArray<FName> Names;      // slot → FName
+    TArray<UTF8CHAR> Bytes;   // concatenated raw names
+    TArray<int32> Buckets;    // open addressing (power of two), INDEX_NONE = empty
+};
@@ -0,0 +1,202 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCOscDecoder.h"
+
+// ---------------- Big-endian readers (OSC is network byte order) ----------------
+
+static FORCEINLINE uint32 ReadU32BE(const uint8* P)
+{
+    return (uint32(P[0]) << 24) | (uint32(P[1]) << 16) | (uint32(P[2]) << 8) | uint32(P[3]);
+}
+
+static FORCEINLINE float ReadF32BE(const uint8* P)
+{
+    const uint32 U = ReadU32BE(P);
+    float F;
+    FMemory::Memcpy(&F, &U, sizeof(F));
+    return F;
+}
+
+// Reads a null-terminated, 4-byte padded OSC string starting at Offset.
+// On success OutView excludes the terminator and Offset is advanced past the padding.
+static bool ReadOscString(const uint8* Data, int32 Size, int32& Offset, FUtf8StringView& OutView)
+{
+    const int32 Start = Offset;
+    int32 End = Start;
+    while (End < Size && Data[End] != 0)
+    {
+        ++End;
+    }
+    if (End >= Size)
+    {
+        return false; // unterminated
+    }
+
+    OutView = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Data + Start), End - Start);
+    Offset = Align(End + 1, 4);
+    return Offset <= Size;
+}
+
+// ---------------- Decoder ----------------
+
+static constexpr int32 MaxBundleDepth = 8;
+static const uint8 BundleTag[8] = { '#', 'b', 'u', 'n', 'd', 'l', 'e', 0 };
+
+bool FVMCOscDecoder::DecodePacket(const uint8* Data, int32 Size, FOnMessage OnMessage)
+{
+    if (!Data || Size <= 0 || (Size & 3) != 0)
+    {
+        return false;
+    }
+    return DecodeElement(Data, Size, 0, 0, OnMessage);
+}
+
+bool FVMCOscDecoder::DecodePacket(const uint8* Data, int32 Size, FOnMessage OnMessage, FOnBundleEnd OnBundleEnd)
+{
+    if (!DecodePacket(Data, Size, OnMessage))
+    {
+        return false;
+    }
+    if (Size >= 16 && FMemory::Memcmp(Data, BundleTag, sizeof(BundleTag)) == 0)
+    {
+        OnBundleEnd((uint64(ReadU32BE(Data + 8)) << 32) | ReadU32BE(Data + 12));
+    }
+    return true;
+}
+
+bool FVMCOscDecoder::DecodeElement(const uint8* Data, int32 Size, int32 Depth, uint64 TimeTag, FOnMessage OnMessage)
+{
+    if (Size >= 16 && FMemory::Memcmp(Data, BundleTag, sizeof(BundleTag)) == 0)
+    {
+        if (Depth >= MaxBundleDepth)
+        {
+            return false;
+        }
+
+        // #bundle, 8-byte timetag, then { int32 size, element } pairs
+        const uint64 BundleTime = (uint64(ReadU32BE(Data + 8)) << 32) | ReadU32BE(Data + 12);
+        int32 Offset = 16;
+        while (Offset + 4 <= Size)
+        {
+            const int32 ElemSize = (int32)ReadU32BE(Data + Offset);
+            Offset += 4;
+            if (ElemSize <= 0 || (ElemSize & 3) != 0 || ElemSize > Size - Offset)   // sizes are untrusted: never add them to Offset before the check
+            {
+                return false;
+            }
+            if (!DecodeElement(Data + Offset, ElemSize, Depth + 1, BundleTime, OnMessage))
+            {
+                return false;
+            }
+            Offset += ElemSize;
+        }
+        return Offset == Size;
+    }
+
+    FVMCOscMessage Msg;
+    if (!DecodeMessage(Data, Size, Msg))
+    {
+        return false;
+    }
+    Msg.TimeTag = TimeTag;
+    Msg.bInBundle = Depth > 0;
+    OnMessage(Msg);
+    return true;
+}
+
+bool FVMCOscDecoder::DecodeMessage(const uint8* Data, int32 Size, FVMCOscMessage& Out)
+{
+    int32 Offset = 0;
+    if (!ReadOscString(Data, Size, Offset, Out.Address) || Out.Address.Len() == 0 || Out.Address[0] != '/')
+    {
+        return false;
+    }
+
+    // Type tags are optional in OSC 1.0; treat a missing tag string as "no arguments"
+    Out.NumArgs = 0;
+    if (Offset >= Size)
+    {
+        return true;
+    }
+
+    FUtf8StringView Tags;
+    if (!ReadOscString(Data, Size, Offset, Tags) || Tags.Len() == 0 || Tags[0] != ',')
+    {
+        return false;
+    }
+
+    const int32 NumTags = Tags.Len() - 1;
+    if (NumTags > FVMCOscMessage::MaxArgs)
+    {
+        return false;
+    }
+
+    for (int32 t = 0; t < NumTags; ++t)
+    {
+        FVMCOscArg& Arg = Out.Args[t];
+        Arg.Type = (ANSICHAR)Tags[t + 1];
+
+        switch (Arg.Type)
+        {
+        case 'f':
+            if (Offset + 4 > Size) return false;
+            Arg.F = ReadF32BE(Data + Offset);
+            Offset += 4;
+            break;
+
+        case 'i':
+            if (Offset + 4 > Size) return false;
+            Arg.I = (int32)ReadU32BE(Data + Offset);
+            Offset += 4;
+            break;
+
+        case 's':
+        case 'S':
+            Arg.Type = 's';
+            if (!ReadOscString(Data, Size, Offset, Arg.S)) return false;
+            break;
+
+        case 'd':
+        {
+            // Narrow doubles to float; VMC only needs float precision
+            if (Offset + 8 > Size) return false;
+            const uint64 U = (uint64(ReadU32BE(Data + Offset)) << 32) | ReadU32BE(Data + Offset + 4);
+            double D;
+            FMemory::Memcpy(&D, &U, sizeof(D));
+            Arg.Type = 'f';
+            Arg.F = (float)D;
+            Offset += 8;
+            break;
+        }
+
+        case 'h':
+        case 't':
+            // 64-bit payloads are skipped; no VMC address uses them
+            if (Offset + 8 > Size) return false;
+            Offset += 8;
+            break;
+
+        case 'b':
+        {
+            if (Offset + 4 > Size) return false;
+            const int32 BlobSize = (int32)ReadU32BE(Data + Offset);
+            Offset += 4;
+            if (BlobSize < 0 || BlobSize > Size - Offset) return false;   // untrusted size: no Offset + BlobSize
+            Offset = Align(Offset + BlobSize, 4);
+            break;
+        }
+
+        case 'T':
+        case 'F':
+        case 'N':
+        case 'I':
+            // No payload
+            break;
+
+        default:
+            return false; // unknown tag → can't know its size
+        }
+    }
+
+    Out.NumArgs = NumTags;
+    return Offset <= Size;
+}
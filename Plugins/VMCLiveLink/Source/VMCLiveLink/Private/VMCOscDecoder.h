@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// One decoded OSC argument. Strings are views into the receive buffer (not null-terminated).
+struct FVMCOscArg
+{
+    ANSICHAR Type = 0; // OSC type tag: 'f', 'i', 's', 'T', 'F', ...
+    union
+    {
+        float F;
+        int32 I = 0;
+    };
+    FUtf8StringView S;
+
+    bool IsNumeric() const { return Type == 'f' || Type == 'i'; }
+    float AsFloat() const { return Type == 'f' ? F : (Type == 'i' ? (float)I : 0.f); }
+    int32 AsInt() const { return Type == 'i' ? I : (Type == 'f' ? (int32)F : (Type == 'T' ? 1 : 0)); }
+};
+
+// A decoded OSC message. Fixed capacity: VMC messages carry at most ~10 arguments.
+struct FVMCOscMessage
+{
+    static constexpr int32 MaxArgs = 16;
+
+    FUtf8StringView Address;
+    uint64 TimeTag = 0;       // NTP timetag of the enclosing bundle (valid when bInBundle)
+    bool bInBundle = false;
+    int32 NumArgs = 0;
+    FVMCOscArg Args[MaxArgs];
+};
+
+/**
+ * Allocation-free OSC 1.0 decoder for the native ingest path.
+ * Works directly on the datagram bytes; views handed to the callback are only valid during the call.
+ */
+class FVMCOscDecoder
+{
+public:
+    using FOnMessage = TFunctionRef<void(const FVMCOscMessage&)>;
+    using FOnBundleEnd = TFunctionRef<void(uint64 TimeTag)>;
+
+    // Decodes a datagram (single message or bundle; nested bundles are flattened in order).
+    // Returns false if the packet is malformed. Messages decoded before the error are still delivered.
+    static bool DecodePacket(const uint8* Data, int32 Size, FOnMessage OnMessage);
+
+    // Same, and additionally calls OnBundleEnd after the last message of a well-formed top-level bundle
+    static bool DecodePacket(const uint8* Data, int32 Size, FOnMessage OnMessage, FOnBundleEnd OnBundleEnd);
+
+    // OSC timetags are NTP fixed point (32.32 seconds since 1900); 0 and 1 ("immediately") carry no time
+    static bool IsTimedTag(uint64 TimeTag) { return TimeTag > 1; }
+    static double TimeTagToSeconds(uint64 TimeTag) { return double(TimeTag >> 32) + double(uint32(TimeTag)) / 4294967296.0; }
+
+private:
+    static bool DecodeElement(const uint8* Data, int32 Size, int32 Depth, uint64 TimeTag, FOnMessage OnMessage);
+    static bool DecodeMessage(const uint8* Data, int32 Size, FVMCOscMessage& Out);
+};
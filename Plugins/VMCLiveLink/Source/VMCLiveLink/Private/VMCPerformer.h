@@ -0,0 +1,160 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VMCNameTable.h"
+#include "VMCFrameTypes.h"
+#include "VMCJitterBuffer.h"
+#include "VMCConcealment.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+class ULiveLinkSubjectRemapper;
+class USkeletalMesh;
+
+// Extra subject fed by /Tra, /Hmd, /Con or /Cam (one per device serial)
+struct FVMCDeviceSubject
+{
+    uint8 Kind = 0;              // EVMCAddress that feeds it
+    TArray<UTF8CHAR> Serial;     // raw serial bytes, compared without building FNames
+    FName SubjectName;
+    bool bStaticSent = false;
+};
+
+// Per-performer ingest counters (written by the ingest thread, read from any thread)
+struct FVMCIngestStats
+{
+    std::atomic<uint64> Datagrams{ 0 };
+    std::atomic<uint64> Messages{ 0 };
+    std::atomic<uint64> BadMessages{ 0 };      // known address, unexpected arguments
+    std::atomic<uint64> UnknownAddresses{ 0 };
+};
+
+// Remap inputs read from a subject's settings, built on the game thread and adopted whole by
+// the ingest thread (immutable once published)
+struct FVMCRemapState
+{
+    TMap<FName, FName> BoneMap;
+    TMap<FName, FName> CurveMap;
+    TMap<FName, FVector> RefLocalTranslationByName;   // reference-pose local translations (mapped names)
+    bool bHaveRefOffsets = false;
+};
+
+using FVMCRemapStatePtr = TSharedPtr<const FVMCRemapState, ESPMode::ThreadSafe>;
+
+/**
+ * Everything one VMC sender (performer) feeds: its Live Link subject, name tables, pending
+ * samples, static layout and frame hand-off. A source owns one per demultiplexed sender.
+ * Threading: owned by the ingest thread; the push step only reads committed frames and
+ * the game thread only touches the atomics and the settings-side remap fields.
+ */
+struct FVMCPerformer
+{
+    FName SubjectName;
+    uint64 SenderKey = 0;          // demux key this performer was created for
+
+    // Name interning: raw OSC name bytes → stable dense slot
+    FVMCNameTable BoneTable;
+    FVMCNameTable CurveTable;      // slot == index in CurveNamesOrdered
+
+    // Bones (output order)
+    TArray<FName> BoneNames;       // index-aligned
+    TArray<int32> BoneParents;     // -1 for root
+    TArray<int32> BoneSlots;       // output index → BoneTable slot
+    int32 HipsIndex = INDEX_NONE;  // output index of the humanoid Hips (live translation under root)
+
+    // Per-frame pose cache (by bone slot), Unity space as sent; converted for the whole frame at commit
+    static constexpr int32 RawPoseStride = 8;  // px, py, pz, 0, qx, qy, qz, qw
+    TArray<float>      PendingPoseRaw;
+    TArray<uint8>      PendingPoseValid;   // 1 once a sample arrived for the slot
+    TArray<FVector4f>  PoseHemisphere;     // last converted rotation per slot (sign continuity)
+    float PendingRootRaw[7] = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 1.f };
+    FTransform PendingRoot = FTransform::Identity;  // PendingRootRaw converted (with yaw offset)
+    bool bPendingRootRaw = false;          // PendingRootRaw changed since the last conversion
+
+    // Curves → Properties (UE 5.6)
+    TArray<FName>     CurveNamesOrdered;   // advertised in StaticData.PropertyNames
+    TArray<float>     PendingCurves;       // per-frame values (by curve slot)
+    TArray<uint8>     PendingCurveValid;   // reset every Apply
+    bool              bStaticCurvesDirty = false;
+
+    // Frame timing
+    uint64 PendingTimeTag = 0;
+    uint64 PendingIngestCycles = 0;        // first sample since the last commit (latency stats)
+    bool   bPendingSamples = false;        // bone/root/curve samples since the last commit
+    double SenderClockOffset = 0.0;        // local seconds - sender seconds (lower envelope)
+    bool   bHaveSenderClock = false;
+
+    // Static layout shared by committed frames; rebuilt on the ingest thread when bLayoutDirty
+    FVMCStaticLayoutPtr CurrentLayout;
+    bool bLayoutDirty = true;
+
+    // Committed frames (ingest writes, push step reads; no locks)
+    FVMCFrameExchange FrameExchange;
+    TUniquePtr<FVMCJitterBuffer> JitterBuffer; // replaces FrameExchange as the hand-off when enabled
+    uint64 FrameSequence = 0;
+    FVMCOutputStats OutputStats;
+    FVMCIngestStats IngestStats;
+    double NextOutputSeconds = 0.0;        // EVMCOutputPolicy::FixedRate: earliest next push (ingest thread)
+
+    // Push step: layout whose static data Live Link has now. PushLock serializes the push step
+    // with the game thread's concealment tick (uncontended otherwise).
+    FCriticalSection PushLock;
+    FVMCStaticLayoutPtr LastPushedLayout;
+    std::atomic<bool> bStaticSent{ false };
+
+    // Last frame sent to Live Link (kept only when the deadband or concealment needs it)
+    TArray<FTransform> LastPushedTransforms;  // deadband reference
+    TArray<float> LastPushedValues;           // deadband reference; curves held while concealing
+    double LastPushSeconds = 0.0;             // heartbeat reference
+
+    // Packet-loss concealment (ConcealMaxMs > 0): fed by real frames, extrapolates during gaps
+    TUniquePtr<FVMCConcealer> Concealer;
+    double LastPushedWorldOffset = 0.0;    // WorldTime - local push time of the last real frame
+
+    // Remap state in use (ingest thread); replaced when the game thread publishes a new one
+    FVMCRemapStatePtr Remap;
+    uint32 SeenSettingsVersion = 0;        // FVMCSettingsVersion the last refresh was requested for
+
+    // Game thread → ingest hand-off of a rebuilt remap state
+    FCriticalSection RemapLock;            // PendingRemap only; taken when bRemapReady is set
+    FVMCRemapStatePtr PendingRemap;
+    std::atomic<bool> bRemapReady{ false };
+    std::atomic<bool> bRemapRefreshQueued{ false };
+
+    // Settings side (game thread): what the current remap state was built from
+    uint32 CachedMapsHash = 0;
+    bool bRemapPublished = false;
+    TMap<FName, FVector> RefLocalTranslationByName;
+    bool bHaveRefOffsets = false;
+    TWeakObjectPtr<ULiveLinkSubjectRemapper> LastSeenRemapper;
+    TWeakObjectPtr<USkeletalMesh> LastRefMeshBuiltFrom;
+
+    // One-shot flag to force static re-publish next Apply (set from any thread)
+    std::atomic<bool> bForceStaticNext{ true };
+    std::atomic<bool> bEnsuredDefaults{ false };
+
+    // Device subjects of this performer
+    TArray<FVMCDeviceSubject> DeviceSubjects;
+
+    // Sizes the per-slot pose arrays to the bone table (new slots: no sample, identity rotation)
+    void GrowPoseSlots()
+    {
+        const int32 Num = BoneTable.Num();
+        const int32 Old = PoseHemisphere.Num();
+        PendingPoseRaw.SetNumZeroed(Num * RawPoseStride);
+        PendingPoseValid.SetNumZeroed(Num);
+        PoseHemisphere.SetNum(Num);
+        for (int32 i = Old; i < Num; ++i)
+        {
+            PoseHemisphere[i] = FVector4f(0.f, 0.f, 0.f, 1.f);
+        }
+    }
+
+    // Sender status (/VMC/Ext/OK, /VMC/Ext/T); -1 = never received
+    std::atomic<int32> SenderLoaded{ -1 };
+    std::atomic<int32> SenderCalibrationState{ -1 };
+    std::atomic<int32> SenderCalibrationMode{ -1 };
+    std::atomic<int32> SenderTrackingStatus{ -1 };
+    std::atomic<float> SenderTime{ 0.f };
+};
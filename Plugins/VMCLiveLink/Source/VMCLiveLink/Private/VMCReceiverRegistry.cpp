@@ -0,0 +1,402 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCReceiverRegistry.h"
+#include "VMCLog.h"
+#include "VMCOscDecoder.h"
+#include "VMCUdpReceiver.h"
+#include "VMCCapture.h"
+#include "VMCStats.h"
+
+#include "UObject/StrongObjectPtr.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+
+// OSC (cpp-only)
+#include "OSCServer.h"
+#include "OSCMessage.h"
+#include "OSCBundle.h"
+#include "OSCManager.h"
+#include "OSCTypes.h"
+
+// Adapts a UOSCServer message to the decoder view so both ingest paths share one handler.
+// String payloads are copied into Scratch; views are built after all appends so they stay valid.
+static bool AdaptOscMessage(const FOSCMessage& Msg, TArray<UTF8CHAR, TInlineAllocator<512>>& Scratch, FVMCOscMessage& Out)
+{
+    const TArray<UE::OSC::FOSCData>& A = Msg.GetArgumentsChecked();
+    if (A.Num() > FVMCOscMessage::MaxArgs) return false;
+
+    auto AppendUtf8 = [&Scratch](const FString& Str, int32& OutOffset, int32& OutLen)
+        {
+            const auto Conv = StringCast<UTF8CHAR>(*Str, Str.Len());
+            OutOffset = Scratch.Num();
+            OutLen = Conv.Length();
+            Scratch.Append(Conv.Get(), Conv.Length());
+        };
+
+    int32 Offsets[FVMCOscMessage::MaxArgs + 1] = {};
+    int32 Lens[FVMCOscMessage::MaxArgs + 1] = {};
+
+    AppendUtf8(Msg.GetAddress().GetFullPath(), Offsets[0], Lens[0]);
+    for (int32 i = 0; i < A.Num(); ++i)
+    {
+        FVMCOscArg& Arg = Out.Args[i];
+        if (A[i].IsString())
+        {
+            Arg.Type = 's';
+            AppendUtf8(A[i].GetString(), Offsets[i + 1], Lens[i + 1]);
+        }
+        else if (A[i].IsFloat())
+        {
+            Arg.Type = 'f';
+            Arg.F = A[i].GetFloat();
+        }
+        else if (A[i].IsInt32())
+        {
+            Arg.Type = 'i';
+            Arg.I = A[i].GetInt32();
+        }
+        else if (A[i].IsBool())
+        {
+            Arg.Type = A[i].GetBool() ? 'T' : 'F';
+        }
+        else
+        {
+            Arg.Type = 'N';
+        }
+    }
+
+    Out.Address = FUtf8StringView(Scratch.GetData() + Offsets[0], Lens[0]);
+    for (int32 i = 0; i < A.Num(); ++i)
+    {
+        if (Out.Args[i].Type == 's')
+        {
+            Out.Args[i].S = FUtf8StringView(Scratch.GetData() + Offsets[i + 1], Lens[i + 1]);
+        }
+    }
+    Out.NumArgs = A.Num();
+    return true;
+}
+
+// ---------------- Port ----------------
+
+struct FVMCReceiverRegistry::FPort
+{
+    int32 Number = 0;
+    EVMCIngestMode Mode = EVMCIngestMode::OSCServer;
+    FString BindAddress;
+    FVMCMulticastOptions Multicast;
+    FString ReplayPath;
+    bool bReplayRealtime = true;
+    bool bReplayLoop = false;
+
+    TUniquePtr<FVMCUdpReceiver> NativeReceiver;
+    TUniquePtr<FVMCCaptureReplayer> Replayer;
+    TStrongObjectPtr<UOSCServer> OscServer;
+    TUniquePtr<FVMCCaptureWriter> Recorder;   // raw datagrams of this port (ingest thread writes)
+
+    // Held while listeners run, so removal waits for an in-flight dispatch
+    FCriticalSection ListenersLock;
+    TArray<TPair<uint64, FOnPacket>> Listeners;
+
+    // Ingest thread scratch (reused; no per-datagram allocations once warm)
+    TArray<FVMCOscMessage> Decoded;
+    TArray<UTF8CHAR, TInlineAllocator<512>> Scratch;
+    int32 OscBundleMessagesLeft = 0;   // OSCServer path: messages of the current bundle still to dispatch
+
+    bool Open();
+    void Close();
+
+    void Dispatch(const FVMCDecodedPacket& Packet);
+    void OnDatagram(const uint8* Data, int32 Size, uint32 FromIp, uint16 FromPort);
+    void OnOscMessage(const FOSCMessage& Msg, const FString& FromIP, uint16 FromPort);
+    void OnOscBundle(const FOSCBundle& Bundle, const FString& FromIP, uint16 FromPort);
+};
+
+bool FVMCReceiverRegistry::FPort::Open()
+{
+    if (Mode == EVMCIngestMode::Replay)
+    {
+        Replayer = MakeUnique<FVMCCaptureReplayer>(
+            [this](const uint8* Data, int32 Size, uint32 FromIp, uint16 FromPort)
+            {
+                OnDatagram(Data, Size, FromIp, FromPort);
+            });
+
+        const FString ThreadName = FString::Printf(TEXT("VMCReplay_%d"), Number);
+        if (!Replayer->Start(ReplayPath, bReplayRealtime, bReplayLoop, ThreadName))
+        {
+            Replayer.Reset();
+            return false;
+        }
+        return true;
+    }
+
+    if (Mode == EVMCIngestMode::NativeUdp)
+    {
+        NativeReceiver = MakeUnique<FVMCUdpReceiver>(
+            [this](const uint8* Data, int32 Size, uint32 FromIp, uint16 FromPort)
+            {
+                OnDatagram(Data, Size, FromIp, FromPort);
+            });
+
+        const FString ThreadName = FString::Printf(TEXT("VMCReceiver_%d"), Number);
+        if (!NativeReceiver->Start(BindAddress, Number, ThreadName, Multicast))
+        {
+            NativeReceiver.Reset();
+            return false;
+        }
+        return true;
+    }
+
+    OscServer = TStrongObjectPtr<UOSCServer>(NewObject<UOSCServer>());
+    if (!OscServer.IsValid())
+    {
+        UE_LOG(LogVMCLiveLink, Error, TEXT("Failed to create UOSCServer"));
+        return false;
+    }
+
+    // Bundles are always counted: listeners in bundle-commit mode need the bundle end
+    OscServer->OnOscMessageReceivedNative.AddRaw(this, &FPort::OnOscMessage);
+    OscServer->OnOscBundleReceivedNative.AddRaw(this, &FPort::OnOscBundle);
+
+    // The OSC server joins a multicast receive address itself (default interface)
+    const bool bMulticast = !Multicast.Group.IsEmpty();
+    if (bMulticast)
+    {
+        if (Multicast.Interface != TEXT("0.0.0.0") && !Multicast.Interface.IsEmpty())
+        {
+            UE_LOG(LogVMCLiveLink, Warning, TEXT("UOSCServer joins %s on the default interface; use ingest=native to pick %s"),
+                *Multicast.Group, *Multicast.Interface);
+        }
+    }
+
+    if (!OscServer->SetAddress(bMulticast ? Multicast.Group : TEXT("0.0.0.0"), (uint16)Number))
+    {
+        UE_LOG(LogVMCLiveLink, Error, TEXT("UOSCServer SetAddress failed for port %d"), Number);
+        OscServer->OnOscMessageReceivedNative.RemoveAll(this);
+        OscServer->OnOscBundleReceivedNative.RemoveAll(this);
+        OscServer.Reset();
+        return false;
+    }
+
+    OscServer->Listen();
+    return true;
+}
+
+void FVMCReceiverRegistry::FPort::Close()
+{
+    if (NativeReceiver.IsValid())
+    {
+        NativeReceiver->Shutdown();
+
+        const FVMCReceiveStats& S = NativeReceiver->GetStats();
+        const uint64 Reads = S.Reads.load();
+        UE_LOG(LogVMCLiveLink, Log, TEXT("VMC port %d receive: datagrams=%llu reads=%llu batch avg=%.1f max=%u dropped=%llu"),
+            Number, S.Datagrams.load(), Reads, Reads > 0 ? (double)S.Datagrams.load() / Reads : 0.0, S.MaxBatch.load(), S.Dropped.load());
+        NativeReceiver.Reset();
+    }
+
+    if (Replayer.IsValid())
+    {
+        Replayer->Shutdown();
+        Replayer.Reset();
+    }
+
+    // Ingest has stopped; nothing writes anymore
+    Recorder.Reset();
+
+    if (OscServer.IsValid())
+    {
+        OscServer->OnOscMessageReceivedNative.RemoveAll(this);
+        OscServer->OnOscBundleReceivedNative.RemoveAll(this);
+        OscServer->Stop();
+        OscServer.Reset();
+    }
+}
+
+void FVMCReceiverRegistry::FPort::Dispatch(const FVMCDecodedPacket& Packet)
+{
+    FScopeLock ScopeLock(&ListenersLock);
+    for (const TPair<uint64, FOnPacket>& L : Listeners)
+    {
+        L.Value(Packet);
+    }
+}
+
+void FVMCReceiverRegistry::FPort::OnDatagram(const uint8* Data, int32 Size, uint32 FromIp, uint16 FromPort)
+{
+    if (Recorder.IsValid())
+    {
+        Recorder->Write(FPlatformTime::Seconds(), FromIp, FromPort, Data, Size);
+    }
+
+    // Decode once into the port's scratch; every listener reads the same views
+    FVMCDecodedPacket Packet;
+    bool bOk = false;
+    {
+        VMC_SCOPED_STAT(Decode);
+        Decoded.Reset();
+        bOk = FVMCOscDecoder::DecodePacket(Data, Size,
+            [this](const FVMCOscMessage& Msg) { Decoded.Add(Msg); },
+            [&Packet](uint64 /*TimeTag: already on each message*/) { Packet.bBundleEnd = true; });
+    }
+    if (!bOk)
+    {
+        UE_LOG(LogVMCLiveLink, VeryVerbose, TEXT("Malformed OSC datagram (%d bytes) on port %d"), Size, Number);
+        Packet.bMalformed = true;   // still dispatched so sources can count it
+    }
+    else if (Decoded.Num() == 0)
+    {
+        return;
+    }
+
+    Packet.Messages = Decoded.GetData();
+    Packet.NumMessages = Decoded.Num();
+    Packet.FromIp = FromIp;
+    Packet.FromPort = FromPort;
+    Dispatch(Packet);
+}
+
+// UOSCServer reports the sender as a string; demux keys are host-order IPv4
+static uint32 ParseSenderIp(const FString& FromIP)
+{
+    FIPv4Address Addr;
+    return FIPv4Address::Parse(FromIP, Addr) ? Addr.Value : 0;
+}
+
+void FVMCReceiverRegistry::FPort::OnOscMessage(const FOSCMessage& Msg, const FString& FromIP, uint16 FromPort)
+{
+    Scratch.Reset();
+    FVMCOscMessage View;
+    const bool bFromBundle = OscBundleMessagesLeft > 0;
+
+    FVMCDecodedPacket Packet;
+    Packet.FromIp = ParseSenderIp(FromIP);
+    Packet.FromPort = FromPort;
+    if (AdaptOscMessage(Msg, Scratch, View))
+    {
+        View.bInBundle = bFromBundle;
+        Packet.Messages = &View;
+        Packet.NumMessages = 1;
+    }
+    else
+    {
+        Packet.bMalformed = true;
+    }
+
+    // UOSCServer does not expose the timetag; the bundle end is the last dispatched message
+    Packet.bBundleEnd = bFromBundle && --OscBundleMessagesLeft == 0;
+    if (Packet.NumMessages > 0 || Packet.bBundleEnd || Packet.bMalformed)
+    {
+        Dispatch(Packet);
+    }
+}
+
+void FVMCReceiverRegistry::FPort::OnOscBundle(const FOSCBundle& Bundle, const FString& FromIP, uint16 FromPort)
+{
+    // The server broadcasts a bundle before dispatching its messages one by one (nested bundles
+    // are broadcast too); counting them down tells us when the last one has been handled
+    OscBundleMessagesLeft += UOSCManager::GetMessagesFromBundle(Bundle).Num();
+}
+
+// ---------------- Registry ----------------
+
+FVMCReceiverRegistry& FVMCReceiverRegistry::Get()
+{
+    static FVMCReceiverRegistry Registry;
+    return Registry;
+}
+
+uint64 FVMCReceiverRegistry::AddListener(int32 Port, const FVMCLiveLinkSourceOptions& Options, FOnPacket OnPacket)
+{
+    const EVMCIngestMode Mode = Options.IngestMode;
+
+    FScopeLock ScopeLock(&Lock);
+
+    TSharedPtr<FPort, ESPMode::ThreadSafe>& Entry = Ports.FindOrAdd(Port);
+    if (!Entry.IsValid())
+    {
+        TSharedPtr<FPort, ESPMode::ThreadSafe> New = MakeShared<FPort, ESPMode::ThreadSafe>();
+        New->Number = Port;
+        New->Mode = Mode;
+        New->BindAddress = Options.BindAddress;
+        New->Multicast = Options.Multicast;
+        New->ReplayPath = Options.ReplayPath;
+        New->bReplayRealtime = Options.bReplayRealtime;
+        New->bReplayLoop = Options.bReplayLoop;
+
+        // The recorder exists before ingest starts, so the ingest thread never sees it change
+        if (!Options.RecordPath.IsEmpty())
+        {
+            if (Mode == EVMCIngestMode::OSCServer)
+            {
+                UE_LOG(LogVMCLiveLink, Warning, TEXT("VMC port %d: recording needs ingest=native (the OSC plugin does not expose datagrams)"), Port);
+            }
+            else
+            {
+                New->Recorder = MakeUnique<FVMCCaptureWriter>();
+                if (!New->Recorder->Open(Options.RecordPath))
+                {
+                    New->Recorder.Reset();
+                }
+            }
+        }
+
+        if (!New->Open())
+        {
+            Ports.Remove(Port);
+            return 0;
+        }
+        Entry = New;
+    }
+    else if (Entry->Mode != Mode || (Mode == EVMCIngestMode::NativeUdp && Entry->BindAddress != Options.BindAddress)
+        || (Mode == EVMCIngestMode::Replay && Entry->ReplayPath != Options.ReplayPath)
+        || Entry->Multicast.Group != Options.Multicast.Group)
+    {
+        UE_LOG(LogVMCLiveLink, Warning, TEXT("VMC port %d is already open (ingest=%d, bind=%s, multicast=%s); sharing it as is"),
+            Port, (int32)Entry->Mode, *Entry->BindAddress,
+            Entry->Multicast.Group.IsEmpty() ? TEXT("off") : *Entry->Multicast.Group);
+    }
+    else if (!Options.RecordPath.IsEmpty() && !Entry->Recorder.IsValid())
+    {
+        UE_LOG(LogVMCLiveLink, Warning, TEXT("VMC port %d is already open without recording; record=%s ignored"), Port, *Options.RecordPath);
+    }
+
+    const uint64 Handle = NextHandle++;
+    {
+        FScopeLock ListenersScope(&Entry->ListenersLock);
+        Entry->Listeners.Emplace(Handle, MoveTemp(OnPacket));
+    }
+
+    UE_LOG(LogVMCLiveLink, Verbose, TEXT("VMC port %d: %d listener(s)"), Port, Entry->Listeners.Num());
+    return Handle;
+}
+
+void FVMCReceiverRegistry::RemoveListener(int32 Port, uint64 Handle)
+{
+    if (Handle == 0)
+    {
+        return;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+
+    TSharedPtr<FPort, ESPMode::ThreadSafe>* Entry = Ports.Find(Port);
+    if (!Entry)
+    {
+        return;
+    }
+
+    bool bLast = false;
+    {
+        // Waits for a dispatch in flight on the ingest thread
+        FScopeLock ListenersScope(&(*Entry)->ListenersLock);
+        (*Entry)->Listeners.RemoveAll([Handle](const TPair<uint64, FOnPacket>& L) { return L.Key == Handle; });
+        bLast = (*Entry)->Listeners.Num() == 0;
+    }
+
+    if (bLast)
+    {
+        // Not under ListenersLock: Close joins the ingest thread, which may be waiting for it
+        (*Entry)->Close();
+        Ports.Remove(Port);
+    }
+}
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "VMCLiveLinkSourceOptions.h"
+
+struct FVMCOscMessage;
+
+// Messages decoded from one datagram (native) or one OSC plugin dispatch, from one sender
+struct FVMCDecodedPacket
+{
+    const FVMCOscMessage* Messages = nullptr;
+    int32 NumMessages = 0;
+    bool bBundleEnd = false;   // these messages complete a top-level bundle
+    bool bMalformed = false;   // (part of) the datagram failed to decode; Messages holds what did
+    uint32 FromIp = 0;         // host byte order
+    uint16 FromPort = 0;
+};
+
+/**
+ * Process-wide owner of VMC receive sockets: one receiver (native socket thread or UOSCServer)
+ * per port, shared by every source listening on it. Each datagram is decoded once and the
+ * decoded messages are handed to all listeners of the port, which apply their own conversion
+ * settings. Listeners are called on the port's ingest thread, one at a time.
+ */
+class FVMCReceiverRegistry
+{
+public:
+    using FOnPacket = TFunction<void(const FVMCDecodedPacket& Packet)>;
+
+    static FVMCReceiverRegistry& Get();
+
+    // Opens the port on first use (the first listener's ingest mode, bind address and multicast
+    // group win). Returns a handle for RemoveListener, or 0 if the port could not be opened.
+    // Game thread (the OSC plugin server is a UObject).
+    uint64 AddListener(int32 Port, const FVMCLiveLinkSourceOptions& Options, FOnPacket OnPacket);
+
+    // After this returns the callback is not running and will not be called again.
+    // The port closes with its last listener.
+    void RemoveListener(int32 Port, uint64 Handle);
+
+private:
+    struct FPort;
+
+    FCriticalSection Lock;   // Ports / NextHandle (add/remove only; never taken on the ingest path)
+    TMap<int32, TSharedPtr<FPort, ESPMode::ThreadSafe>> Ports;
+    uint64 NextHandle = 1;
+};
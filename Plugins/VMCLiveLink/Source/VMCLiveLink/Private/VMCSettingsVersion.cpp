@@ -0,0 +1,37 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCSettingsVersion.h"
+#include "VMCLiveLinkRemapper.h"
+#include "LiveLinkSubjectSettings.h"
+#include "UObject/UObjectGlobals.h"
+
+std::atomic<uint32> FVMCSettingsVersion::Version{ 1 };
+
+#if WITH_EDITOR
+FDelegateHandle FVMCSettingsVersion::PropertyChangedHandle;
+
+void FVMCSettingsVersion::RegisterEditHooks()
+{
+    if (PropertyChangedHandle.IsValid())
+    {
+        return;
+    }
+
+    // Covers inline edits of a subject's remapper too: the remapper is the object that changed
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([](UObject* Object, FPropertyChangedEvent&)
+    {
+        if (Object && (Object->IsA<ULiveLinkSubjectRemapper>() || Object->IsA<ULiveLinkSubjectSettings>()))
+        {
+            Bump();
+        }
+    });
+}
+
+void FVMCSettingsVersion::UnregisterEditHooks()
+{
+    if (PropertyChangedHandle.IsValid())
+    {
+        FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+        PropertyChangedHandle.Reset();
+    }
+}
+#endif
@@ -0,0 +1,34 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Delegates/IDelegateInstance.h"
+#include <atomic>
+
+/**
+ * Process-wide change counter for everything the receive path caches from settings objects
+ * (remapper maps and reference skeleton, Live Link subject settings). UVMCLiveLinkSettings only
+ * seeds new subjects, so nothing is cached from it.
+ * Writers bump it when they change; ingest threads compare it once per frame and only rebuild
+ * their caches when it moved, instead of re-reading the settings every frame.
+ * Who bumps: the remapper's SyncWorker, and in the editor any property edit of these objects. A source also notices a subject's remapper
+ * being swapped by code (FVMCLiveLinkSource::Update).
+ */
+class FVMCSettingsVersion
+{
+public:
+    static uint32 Get() { return Version.load(std::memory_order_acquire); }
+    static void Bump() { Version.fetch_add(1, std::memory_order_acq_rel); }
+
+#if WITH_EDITOR
+    // Bumps on property edits (Details panel, undo) of the settings objects above. Module lifetime.
+    static void RegisterEditHooks();
+    static void UnregisterEditHooks();
+#endif
+
+private:
+    static std::atomic<uint32> Version;
+#if WITH_EDITOR
+    static FDelegateHandle PropertyChangedHandle;
+#endif
+};
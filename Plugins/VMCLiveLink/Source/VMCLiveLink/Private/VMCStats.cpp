@@ -0,0 +1,17 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCStats.h"
+
+DEFINE_STAT(STAT_VMC_Decode);
+DEFINE_STAT(STAT_VMC_HandlePacket);
+DEFINE_STAT(STAT_VMC_CommitFrame);
+DEFINE_STAT(STAT_VMC_PushFrame);
+DEFINE_STAT(STAT_VMC_PushStaticData);
+DEFINE_STAT(STAT_VMC_RefreshStaticMaps);
+
+DEFINE_STAT(STAT_VMC_Datagrams);
+DEFINE_STAT(STAT_VMC_Messages);
+DEFINE_STAT(STAT_VMC_FramesPushed);
+DEFINE_STAT(STAT_VMC_StaticPushes);
+DEFINE_STAT(STAT_VMC_ParseFailures);
+
+CSV_DEFINE_CATEGORY(VMCLiveLink, true);
@@ -0,0 +1,37 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// `stat VMCLiveLink`: hot-path timings and per-frame counters, summed over all sources
+DECLARE_STATS_GROUP(TEXT("VMC Live Link"), STATGROUP_VMCLiveLink, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode datagram"), STAT_VMC_Decode, STATGROUP_VMCLiveLink, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Handle packet"), STAT_VMC_HandlePacket, STATGROUP_VMCLiveLink, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Commit frame"), STAT_VMC_CommitFrame, STATGROUP_VMCLiveLink, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Push frame"), STAT_VMC_PushFrame, STATGROUP_VMCLiveLink, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Push static data"), STAT_VMC_PushStaticData, STATGROUP_VMCLiveLink, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Refresh remap from settings"), STAT_VMC_RefreshStaticMaps, STATGROUP_VMCLiveLink, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Datagrams"), STAT_VMC_Datagrams, STATGROUP_VMCLiveLink, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Messages"), STAT_VMC_Messages, STATGROUP_VMCLiveLink, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Frames pushed"), STAT_VMC_FramesPushed, STATGROUP_VMCLiveLink, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Static pushes"), STAT_VMC_StaticPushes, STATGROUP_VMCLiveLink, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Malformed / bad messages"), STAT_VMC_ParseFailures, STATGROUP_VMCLiveLink, );
+
+// CSV profiler category (-csvCategories=VMCLiveLink)
+CSV_DECLARE_CATEGORY_EXTERN(VMCLiveLink);
+
+// One scope for all three profilers: stat cycle counter, Insights CPU event and CSV timing
+#define VMC_SCOPED_STAT(Name) \
+    SCOPE_CYCLE_COUNTER(STAT_VMC_##Name); \
+    TRACE_CPUPROFILER_EVENT_SCOPE(VMC_##Name); \
+    CSV_SCOPED_TIMING_STAT(VMCLiveLink, Name)
+
+// Adds N to a per-frame counter in both the stat group and the CSV capture
+#define VMC_COUNT(Name, N) \
+    INC_DWORD_STAT_BY(STAT_VMC_##Name, N); \
+    CSV_CUSTOM_STAT(VMCLiveLink, Name, (int32)(N), ECsvCustomStatOp::Accumulate)
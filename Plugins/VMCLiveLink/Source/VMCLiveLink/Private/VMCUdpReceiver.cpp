@@ -0,0 +1,381 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#include "VMCUdpReceiver.h"
+#include "VMCLog.h"
+
+#include "HAL/RunnableThread.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+#include "Common/UdpSocketBuilder.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+
+#define VMC_BATCHED_RECV PLATFORM_LINUX
+
+#if VMC_BATCHED_RECV
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#ifndef IP_MULTICAST_ALL
+#define IP_MULTICAST_ALL 49   // linux/in.h; missing from older libc headers
+#endif
+#endif
+
+static constexpr int32 MaxDatagramSize = 65536;
+static constexpr int32 SocketReceiveBufferSize = 4 * 1024 * 1024; // absorb bursts from many performers
+static const FTimespan WaitTimeout = FTimespan::FromMilliseconds(100); // shutdown responsiveness
+
+static void NoteBatch(FVMCReceiveStats& Stats, int32 Count)
+{
+    Stats.Datagrams.fetch_add(Count, std::memory_order_relaxed);
+    Stats.Reads.fetch_add(1, std::memory_order_relaxed);
+    if ((uint32)Count > Stats.MaxBatch.load(std::memory_order_relaxed))
+    {
+        Stats.MaxBatch.store((uint32)Count, std::memory_order_relaxed);
+    }
+}
+
+#if VMC_BATCHED_RECV
+
+// ---------------- recvmmsg (Linux) ----------------
+
+struct FVMCUdpReceiver::FBatch
+{
+    static constexpr int32 Size = 32;   // datagrams per syscall (pool = Size × MaxDatagramSize)
+
+    int Fd = -1;
+    TArray<uint8> Pool;
+    mmsghdr Msgs[Size];
+    iovec Iov[Size];
+    sockaddr_in From[Size];
+    alignas(cmsghdr) uint8 Control[Size][CMSG_SPACE(sizeof(uint32))];
+
+    ~FBatch()
+    {
+        if (Fd >= 0)
+        {
+            close(Fd);
+        }
+    }
+
+    // Same socket setup as the FUdpSocketBuilder path, plus the kernel drop counter
+    bool Open(const FIPv4Address& Addr, int32 Port, const FIPv4Address* Group, const FIPv4Address& Interface, int32& OutBufferSize)
+    {
+        Fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (Fd < 0)
+        {
+            return false;
+        }
+
+        const int One = 1;
+        int RcvBuf = SocketReceiveBufferSize;
+        setsockopt(Fd, SOL_SOCKET, SO_REUSEADDR, &One, sizeof(One));
+        setsockopt(Fd, SOL_SOCKET, SO_RCVBUF, &RcvBuf, sizeof(RcvBuf));
+        setsockopt(Fd, SOL_SOCKET, SO_RXQ_OVFL, &One, sizeof(One));
+
+        sockaddr_in Bind = {};
+        Bind.sin_family = AF_INET;
+        Bind.sin_port = htons((uint16)Port);
+        Bind.sin_addr.s_addr = htonl(Addr.Value);
+        if (bind(Fd, (const sockaddr*)&Bind, sizeof(Bind)) != 0)
+        {
+            return false;
+        }
+
+        if (Group)
+        {
+            ip_mreq Join = {};
+            Join.imr_multiaddr.s_addr = htonl(Group->Value);
+            Join.imr_interface.s_addr = htonl(Interface.Value);
+            if (setsockopt(Fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &Join, sizeof(Join)) != 0)
+            {
+                return false;
+            }
+            // Linux otherwise delivers any group some process on the host joined on this port to a
+            // 0.0.0.0-bound socket; keep it to this socket's own membership (what other OSes do)
+            const int Zero = 0;
+            setsockopt(Fd, IPPROTO_IP, IP_MULTICAST_ALL, &Zero, sizeof(Zero));
+        }
+
+        socklen_t Len = sizeof(RcvBuf);
+        getsockopt(Fd, SOL_SOCKET, SO_RCVBUF, &RcvBuf, &Len);
+        OutBufferSize = RcvBuf;
+
+        Pool.SetNumUninitialized(Size * MaxDatagramSize);
+        for (int32 i = 0; i < Size; ++i)
+        {
+            Iov[i].iov_base = Pool.GetData() + i * MaxDatagramSize;
+            Iov[i].iov_len = MaxDatagramSize;
+        }
+        return true;
+    }
+
+    // Headers are in/out: reset lengths before every call
+    void Arm()
+    {
+        FMemory::Memzero(Msgs, sizeof(Msgs));
+        for (int32 i = 0; i < Size; ++i)
+        {
+            msghdr& H = Msgs[i].msg_hdr;
+            H.msg_name = &From[i];
+            H.msg_namelen = sizeof(sockaddr_in);
+            H.msg_iov = &Iov[i];
+            H.msg_iovlen = 1;
+            H.msg_control = Control[i];
+            H.msg_controllen = sizeof(Control[i]);
+        }
+    }
+
+    // Cumulative drops on this socket, when the kernel attached the counter
+    static bool ReadDropCounter(msghdr& H, uint32& OutDropped)
+    {
+        for (cmsghdr* C = CMSG_FIRSTHDR(&H); C; C = CMSG_NXTHDR(&H, C))
+        {
+            if (C->cmsg_level == SOL_SOCKET && C->cmsg_type == SO_RXQ_OVFL)
+            {
+                FMemory::Memcpy(&OutDropped, CMSG_DATA(C), sizeof(uint32));
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+void FVMCUdpReceiver::RunBatched()
+{
+    const int TimeoutMs = (int)WaitTimeout.GetTotalMilliseconds();
+    while (!bStopping)
+    {
+        pollfd Poll = { Batch->Fd, POLLIN, 0 };
+        if (poll(&Poll, 1, TimeoutMs) <= 0)
+        {
+            continue;
+        }
+
+        // Drain everything that is queued before waiting again, a pool at a time
+        while (!bStopping)
+        {
+            Batch->Arm();
+            const int Count = recvmmsg(Batch->Fd, Batch->Msgs, FBatch::Size, MSG_DONTWAIT, nullptr);
+            if (Count <= 0)
+            {
+                break; // EAGAIN: drained
+            }
+            NoteBatch(Stats, Count);
+
+            for (int32 i = 0; i < Count; ++i)
+            {
+                msghdr& H = Batch->Msgs[i].msg_hdr;
+                uint32 Dropped = 0;
+                if (FBatch::ReadDropCounter(H, Dropped))
+                {
+                    Stats.Dropped.store(Dropped, std::memory_order_relaxed);
+                }
+                if (H.msg_flags & MSG_TRUNC)
+                {
+                    continue;
+                }
+                OnDatagram((const uint8*)Batch->Iov[i].iov_base, (int32)Batch->Msgs[i].msg_len,
+                    ntohl(Batch->From[i].sin_addr.s_addr), ntohs(Batch->From[i].sin_port));
+            }
+
+            if (Count < FBatch::Size)
+            {
+                break;
+            }
+        }
+    }
+}
+
+#else
+
+struct FVMCUdpReceiver::FBatch {};
+
+void FVMCUdpReceiver::RunBatched()
+{
+}
+
+#endif // VMC_BATCHED_RECV
+
+// ---------------- Receiver ----------------
+
+FVMCUdpReceiver::FVMCUdpReceiver(FOnDatagram InOnDatagram)
+    : OnDatagram(MoveTemp(InOnDatagram))
+{
+}
+
+FVMCUdpReceiver::~FVMCUdpReceiver()
+{
+    Shutdown();
+}
+
+bool FVMCUdpReceiver::Start(const FString& BindAddress, int32 Port, const FString& ThreadName, const FVMCMulticastOptions& Multicast)
+{
+    if (Thread)
+        return true;
+
+    FIPv4Address Addr = FIPv4Address::Any;
+    if (!BindAddress.IsEmpty() && !FIPv4Address::Parse(BindAddress, Addr))
+    {
+        UE_LOG(LogVMCLiveLink, Error, TEXT("Invalid bind address '%s'"), *BindAddress);
+        return false;
+    }
+
+    const bool bMulticast = !Multicast.Group.IsEmpty();
+    FIPv4Address Group, Interface = FIPv4Address::Any;
+    if (bMulticast)
+    {
+        if (!FIPv4Address::Parse(Multicast.Group, Group) || !Group.IsMulticastAddress())
+        {
+            UE_LOG(LogVMCLiveLink, Error, TEXT("'%s' is not an IPv4 multicast group"), *Multicast.Group);
+            return false;
+        }
+        if (!Multicast.Interface.IsEmpty() && !FIPv4Address::Parse(Multicast.Interface, Interface))
+        {
+            UE_LOG(LogVMCLiveLink, Error, TEXT("Invalid multicast interface '%s'"), *Multicast.Interface);
+            return false;
+        }
+        // Group traffic is only delivered to wildcard-bound sockets (on Linux in particular);
+        // the interface to receive on is chosen by the join instead
+        if (Addr != FIPv4Address::Any)
+        {
+            UE_LOG(LogVMCLiveLink, Warning, TEXT("Multicast receiver binds 0.0.0.0 (bind=%s ignored; use the multicast interface)"), *BindAddress);
+            Addr = FIPv4Address::Any;
+        }
+    }
+
+    int32 ActualBufferSize = 0;
+#if VMC_BATCHED_RECV
+    Batch = MakeUnique<FBatch>();
+    if (!Batch->Open(Addr, Port, bMulticast ? &Group : nullptr, Interface, ActualBufferSize))
+    {
+        const int Error = errno;
+        if (bMulticast)
+        {
+            UE_LOG(LogVMCLiveLink, Error, TEXT("Native VMC receiver failed to join %s on %s (port %d, errno %d)"), *Group.ToString(), *Interface.ToString(), Port, Error);
+        }
+        else
+        {
+            UE_LOG(LogVMCLiveLink, Error, TEXT("Native VMC receiver failed to bind %s:%d (errno %d)"), *Addr.ToString(), Port, Error);
+        }
+        Batch.Reset();
+        return false;
+    }
+#else
+    FUdpSocketBuilder Builder(*ThreadName);
+    Builder
+        .AsNonBlocking()
+        .AsReusable()
+        .BoundToEndpoint(FIPv4Endpoint(Addr, (uint16)Port))
+        .WithReceiveBufferSize(SocketReceiveBufferSize);
+    if (bMulticast)
+    {
+        Builder.JoinedToGroup(Group, Interface);
+    }
+
+    Socket = Builder.Build();
+
+    if (!Socket)
+    {
+        if (bMulticast)
+        {
+            UE_LOG(LogVMCLiveLink, Error, TEXT("Native VMC receiver failed to join %s on %s (port %d)"), *Group.ToString(), *Interface.ToString(), Port);
+        }
+        else
+        {
+            UE_LOG(LogVMCLiveLink, Error, TEXT("Native VMC receiver failed to bind %s:%d"), *Addr.ToString(), Port);
+        }
+        return false;
+    }
+    Socket->SetReceiveBufferSize(SocketReceiveBufferSize, ActualBufferSize);
+    Buffer.SetNumUninitialized(MaxDatagramSize);
+#endif
+
+    bStopping = false;
+
+    Thread = FRunnableThread::Create(this, *ThreadName, 0, TPri_AboveNormal);
+    if (!Thread)
+    {
+        if (Socket)
+        {
+            ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+            Socket = nullptr;
+        }
+        Batch.Reset();
+        return false;
+    }
+
+    if (bMulticast)
+    {
+        UE_LOG(LogVMCLiveLink, Log, TEXT("Native VMC receiver joined %s on %s, port %d (rcvbuf=%d)"),
+            *Group.ToString(), *Interface.ToString(), Port, ActualBufferSize);
+    }
+    else
+    {
+        UE_LOG(LogVMCLiveLink, Verbose, TEXT("Native VMC receiver bound %s:%d (rcvbuf=%d)"), *Addr.ToString(), Port, ActualBufferSize);
+    }
+    return true;
+}
+
+void FVMCUdpReceiver::Shutdown()
+{
+    if (Thread)
+    {
+        Thread->Kill(/*bShouldWait=*/true); // calls Stop() and joins
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    if (Socket)
+    {
+        Socket->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+        Socket = nullptr;
+    }
+
+    Batch.Reset(); // closes the recvmmsg socket
+}
+
+uint32 FVMCUdpReceiver::Run()
+{
+    if (Batch.IsValid())
+    {
+        RunBatched();
+    }
+    else
+    {
+        RunPortable();
+    }
+    return 0;
+}
+
+void FVMCUdpReceiver::RunPortable()
+{
+    TSharedRef<FInternetAddr> Sender = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+
+    while (!bStopping)
+    {
+        if (!Socket->Wait(ESocketWaitConditions::WaitForRead, WaitTimeout))
+        {
+            continue;
+        }
+
+        // Drain everything that is queued before waiting again
+        int32 BytesRead = 0;
+        while (!bStopping && Socket->RecvFrom(Buffer.GetData(), Buffer.Num(), BytesRead, *Sender))
+        {
+            if (BytesRead <= 0)
+            {
+                break;
+            }
+
+            NoteBatch(Stats, 1);
+
+            uint32 FromIp = 0;
+            Sender->GetIp(FromIp);
+            OnDatagram(Buffer.GetData(), BytesRead, FromIp, (uint16)Sender->GetPort());
+        }
+    }
+}
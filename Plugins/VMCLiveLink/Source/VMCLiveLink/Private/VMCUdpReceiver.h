@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "VMCLiveLinkSourceOptions.h"
+#include <atomic>
+
+class FSocket;
+class FRunnableThread;
+
+// Receive-side counters (receiver thread writes, any thread reads)
+struct FVMCReceiveStats
+{
+    std::atomic<uint64> Datagrams{ 0 };
+    std::atomic<uint64> Reads{ 0 };       // receive syscalls that returned data
+    std::atomic<uint32> MaxBatch{ 0 };    // most datagrams returned by one read
+    std::atomic<uint64> Dropped{ 0 };     // datagrams the kernel dropped on a full socket buffer (Linux only)
+};
+
+/**
+ * Minimal UDP reader thread for the native VMC ingest path.
+ * On Linux the socket is drained with recvmmsg into a preallocated pool of datagram buffers
+ * (many datagrams per syscall, kernel drop counter via SO_RXQ_OVFL); elsewhere an FSocket is
+ * read one datagram at a time into one preallocated buffer. Either way each datagram is handed
+ * to the callback straight from its buffer (valid only for the duration of the call).
+ */
+class FVMCUdpReceiver : public FRunnable
+{
+public:
+    // Called on the receiver thread. FromIp is host byte order.
+    using FOnDatagram = TFunction<void(const uint8* Data, int32 Size, uint32 FromIp, uint16 FromPort)>;
+
+    explicit FVMCUdpReceiver(FOnDatagram InOnDatagram);
+    virtual ~FVMCUdpReceiver() override;
+
+    // Binds the socket (joining Multicast.Group when set) and starts the thread.
+    // Returns false if the socket could not be bound or the group joined.
+    bool Start(const FString& BindAddress, int32 Port, const FString& ThreadName, const FVMCMulticastOptions& Multicast = FVMCMulticastOptions());
+
+    // Stops the thread and closes the socket (blocking, safe to call twice).
+    void Shutdown();
+
+    bool IsRunning() const { return Thread != nullptr; }
+
+    const FVMCReceiveStats& GetStats() const { return Stats; }
+
+    // FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override { bStopping = true; }
+
+private:
+    void RunPortable();
+
+    FOnDatagram OnDatagram;
+
+    FSocket* Socket = nullptr;
+    FRunnableThread* Thread = nullptr;
+    std::atomic<bool> bStopping{ false };
+
+    TArray<uint8> Buffer; // one max-size datagram
+
+    // recvmmsg path (Linux): own socket + buffer pool, replaces Socket/Buffer
+    struct FBatch;
+    TUniquePtr<FBatch> Batch;
+    void RunBatched();
+
+    FVMCReceiveStats Stats;
+};
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VMCCurveRules.generated.h"
+
+// What a curve rule computes from its inputs
+UENUM(BlueprintType)
+enum class EVMCCurveOp : uint8
+{
+	Copy,    // Output = Input
+	Scale,   // Output = Input × Scale
+	Clamp,   // Output = clamp(Input, ClampMin, ClampMax); no input = clamp the output in place
+	Mirror,  // Output = Input × Scale, only when the sender does not provide Output (see bAddMissingOutput)
+	Max,     // Output = max(Inputs)
+	Min,     // Output = min(Inputs)
+	Blend    // Output = Σ Weights[i] × Inputs[i] (equal weights when none are given)
+};
+
+/**
+ * One declarative curve rule, applied by the remapper to every frame's curve values in list
+ * order (later rules see earlier outputs). Names are post-remap curve names. Rules whose
+ * output, or all of whose inputs, the subject does not carry are skipped.
+ */
+USTRUCT(BlueprintType)
+struct VMCLIVELINK_API FVMCCurveRule
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curve Rule")
+	EVMCCurveOp Op = EVMCCurveOp::Copy;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curve Rule")
+	TArray<FName> Inputs;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curve Rule")
+	FName Output;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curve Rule", meta = (EditCondition = "Op == EVMCCurveOp::Scale || Op == EVMCCurveOp::Mirror", EditConditionHides))
+	float Scale = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curve Rule", meta = (EditCondition = "Op == EVMCCurveOp::Blend", EditConditionHides))
+	TArray<float> Weights;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curve Rule", meta = (EditCondition = "Op == EVMCCurveOp::Clamp", EditConditionHides))
+	float ClampMin = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curve Rule", meta = (EditCondition = "Op == EVMCCurveOp::Clamp", EditConditionHides))
+	float ClampMax = 1.f;
+
+	// Mirror: add Output to the subject's curves when the sender lacks it. Off = the rule does
+	// nothing for a missing Output, and the subject's curve list stays what the sender sent.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curve Rule", meta = (EditCondition = "Op == EVMCCurveOp::Mirror", EditConditionHides))
+	bool bAddMissingOutput = false;
+
+	// Clamp the result to 0..1 (blendshape range)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Curve Rule")
+	bool bClampToUnit = true;
+};
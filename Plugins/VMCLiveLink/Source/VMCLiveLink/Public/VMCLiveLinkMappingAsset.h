@@ -4,8 +4,11 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "Engine/SkeletalMesh.h"
+#include "VMCCurveRules.h"
 #include "VMCLiveLinkMappingAsset.generated.h"
 
+struct FAssetData;
+
 UCLASS(BlueprintType)
 class VMCLIVELINK_API UVMCLiveLinkMappingAsset : public UDataAsset
 {
@@ -18,6 +21,10 @@ public:
 	UPROPERTY(EditAnywhere, Category="Mapping")
 	TMap<FName, FName> CurveNameMap;
 
+	// Curve shaping for this rig (see FVMCCurveRule); copied into the remapper with the maps
+	UPROPERTY(EditAnywhere, Category="Mapping")
+	TArray<FVMCCurveRule> CurveRules;
+
 	// Hint meshes that this mapping applies to (optional; used for auto-detect)
 	UPROPERTY(EditAnywhere, Category="Detection")
 	TArray<TSoftObjectPtr<USkeletalMesh>> ExampleReferenceMeshes;
@@ -37,5 +44,18 @@ public:
 
 	// Utility: compute a normalized signature for a mesh's RefSkeleton
 	static uint32 ComputeSignature(const USkeletalMesh* Mesh);
+
+	// Hash of a bone name after normalization (case, '_' and '-' ignored); fingerprint entries
+	static uint32 HashNormalizedName(const FName Name);
+
+	// What auto-detect compares: signatures, example mesh paths and a fingerprint of the
+	// normalized target bone names (one hash per BoneNameMap entry, sorted)
+	void GetDetectionData(TArray<uint32>& OutSignatures, TArray<FSoftObjectPath>& OutExampleMeshes, TArray<uint32>& OutFingerprint) const;
+
+	// The same, read from registry tags without loading the asset; false if the asset was saved
+	// before the tags existed
+	static bool ReadDetectionTags(const FAssetData& AssetData, TArray<uint32>& OutSignatures, TArray<FSoftObjectPath>& OutExampleMeshes, TArray<uint32>& OutFingerprint);
+
+	virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
 #endif
 };
\ No newline at end of file
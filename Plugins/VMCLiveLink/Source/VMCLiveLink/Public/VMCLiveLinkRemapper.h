@@ -10,6 +10,8 @@
 #include "Roles/LiveLinkAnimationTypes.h"
 #include "Engine/SkeletalMesh.h"
 #include "VMCLiveLinkMappingAsset.h" // new
+#include "VMCCurveRules.h"
+#include "Misc/ScopeRWLock.h"
 #if WITH_EDITOR
 #include "UObject/SoftObjectPtr.h"
 #endif
@@ -30,89 +32,99 @@ enum class ELLRemapPreset : uint8
 
 
 // ---------------- Worker ----------------
-class FVMCLiveLinkRemapperWorker final : public ILiveLinkSubjectRemapperWorker
+struct FVMCCurveProgram;
+
+// What the remapper asset hands its worker: built on the game thread, immutable once published
+struct FVMCRemapperConfig
 {
-public:
-	// Value shaping toggles (copied from asset on CreateWorker)
-	bool  bEnableMetaHumanCurveNormalizer = true;
-	float JoyToSmileStrength = 1.0f;
-	float BlinkMirrorStrength = 1.0f;
+	TMap<FName, FName> BoneNameMap;
+	TMap<FName, FName> CurveNameMap;
+	TArray<FVMCCurveRule> CurveRules;   // normalizer built-ins first, then the asset's
+};
 
-	virtual void RemapStaticData(FLiveLinkStaticDataStruct& InOutStaticData) override
+// A name map compiled for one incoming name list: source index → index into the distinct
+// target names. Static data of the same shape remaps by gather; frame-level consumers can use
+// SourceToTarget to address per-target data by incoming bone/curve index.
+struct FVMCNameRemapTable
+{
+	uint32 SourceHash = 0;          // hash of the incoming names (order-sensitive)
+	int32 NumSource = 0;
+	TArray<FName> SourceNames;      // the incoming names; a hash hit is confirmed against them
+	TArray<FName> TargetNames;      // distinct output names, first-use order
+	TArray<int32> SourceToTarget;   // incoming index → TargetNames index
+
+	// Case-sensitive: unmapped names pass through as spelled
+	bool Matches(uint32 Hash, const TArray<FName>& Names) const
 	{
-		if (!InOutStaticData.IsValid() ||
-			!InOutStaticData.GetStruct()->IsChildOf<FLiveLinkSkeletonStaticData>()) return;
-
-		auto& Skel = *InOutStaticData.Cast<FLiveLinkSkeletonStaticData>();
-
-		// Bones (use accessors for safety)
-		TArray<FName> Remapped = Skel.GetBoneNames();
-		for (FName& N : Remapped)
+		if (SourceHash != Hash || NumSource != Names.Num())
 		{
-			if (const FName* Out = BoneNameMap.Find(N)) N = *Out;
+			return false;
 		}
-		Skel.SetBoneNames(Remapped);
-
-		// Curves live on base static data in 5.6
-		FLiveLinkBaseStaticData& Base = static_cast<FLiveLinkBaseStaticData&>(Skel);
-		for (FName& C : Base.PropertyNames)
+		for (int32 i = 0; i < NumSource; ++i)
 		{
-			if (const FName* Out = CurveNameMap.Find(C)) C = *Out;
+			if (!SourceNames[i].IsEqual(Names[i], ENameCase::CaseSensitive))
+			{
+				return false;
+			}
 		}
+		return true;
 	}
+};
 
-	virtual void RemapFrameData(const FLiveLinkStaticDataStruct& InStatic, FLiveLinkFrameDataStruct& InOutFrameData) override
-	{
-		if (!InStatic.IsValid() || !InOutFrameData.IsValid()) return;
-		if (!InStatic.GetStruct()->IsChildOf<FLiveLinkSkeletonStaticData>() ||
-			!InOutFrameData.GetStruct()->IsChildOf<FLiveLinkAnimationFrameData>()) return;
+using FVMCNameRemapTablePtr = TSharedPtr<const FVMCNameRemapTable, ESPMode::ThreadSafe>;
 
-		const FLiveLinkBaseStaticData& Base = *InStatic.Cast<FLiveLinkBaseStaticData>();
-		const TArray<FName>& Names = Base.PropertyNames;
+// Worker state as remapping sees it: a config plus what was compiled from it against the
+// subject's static data. Replaced whole, never modified.
+struct FVMCRemapperSnapshot
+{
+	TSharedPtr<const FVMCRemapperConfig, ESPMode::ThreadSafe> Config;
+	FVMCNameRemapTablePtr BoneTable;    // null until static data was remapped
+	FVMCNameRemapTablePtr CurveTable;
+	TSharedPtr<const FVMCCurveProgram, ESPMode::ThreadSafe> Program;   // null until compiled
+	uint32 StaticNamesHash = 0;         // last remapped static data: its names and how many the sender sent
+	int32 StaticNumSentNames = 0;
+};
 
+/**
+ * Live Link calls RemapStaticData / RemapFrameData on whatever thread pushes, possibly while
+ * the asset is being edited. Remapping pins the current snapshot (a shared pointer copied under
+ * a read lock that only the rare writers contend for) and works on it unlocked; writers (asset
+ * edits, curve program compiles) build a new snapshot and swap it in. A replaced snapshot lives
+ * until the last remap holding it finishes.
+ */
+class FVMCLiveLinkRemapperWorker final : public ILiveLinkSubjectRemapperWorker
+{
+public:
+	virtual void RemapStaticData(FLiveLinkStaticDataStruct& InOutStaticData) override;
+	virtual void RemapFrameData(const FLiveLinkStaticDataStruct& InStatic, FLiveLinkFrameDataStruct& InOutFrameData) override;
 
-		auto& Anim = *InOutFrameData.Cast<FLiveLinkAnimationFrameData>();
-		TArray<float>& Values = Anim.PropertyValues;
+	// Game thread: new maps and rules; curve rules recompile at the next static remap
+	void Publish(TSharedPtr<const FVMCRemapperConfig, ESPMode::ThreadSafe> Config);
 
-		if (!bEnableMetaHumanCurveNormalizer) return;
+	// Bone permutation of the last remapped static data (null before the first); any thread
+	FVMCNameRemapTablePtr GetBoneRemapTable() const;
 
-		auto FindIdx = [&](FName Name)->int32 { return Names.IndexOfByKey(Name); };
-		auto Get = [&](FName Name, float& Out)->bool {
-			const int32 I = FindIdx(Name);
-			if (I != INDEX_NONE && Values.IsValidIndex(I)) { Out = Values[I]; return true; }
-			return false;
-			};
-		auto Set = [&](FName Name, float Val)->void {
-			const int32 I = FindIdx(Name);
-			if (I != INDEX_NONE && Values.IsValidIndex(I)) { Values[I] = Val; }
-			};
-
-		// Blink mirroring
-		float BlinkL = 0.f, BlinkR = 0.f;
-		const bool HasL = Get("eyeBlinkLeft", BlinkL);
-		const bool HasR = Get("eyeBlinkRight", BlinkR);
-		if (HasL && !HasR) Set("eyeBlinkRight", FMath::Clamp(BlinkL * BlinkMirrorStrength, 0.f, 1.f));
-		if (HasR && !HasL) Set("eyeBlinkLeft", FMath::Clamp(BlinkR * BlinkMirrorStrength, 0.f, 1.f));
-
-		// Smile spreading
-		float Joy = 0.f;
-		if (Get("mouthSmileLeft", Joy))
-		{
-			const float V = FMath::Clamp(Joy * JoyToSmileStrength, 0.f, 1.f);
-			Set("mouthSmileLeft", V);
-			Set("mouthSmileRight", V);
-		}
+private:
+	using FSnapshotPtr = TSharedPtr<const FVMCRemapperSnapshot, ESPMode::ThreadSafe>;
+	using FProgramPtr = TSharedPtr<const FVMCCurveProgram, ESPMode::ThreadSafe>;
 
-		// Funnel→pucker blend
-		float Funnel = 0.f;
-		if (Get("mouthFunnel", Funnel))
-		{
-			Set("mouthPucker", FMath::Clamp(Funnel * 0.5f, 0.f, 1.f));
-		}
+	// Pins the current snapshot (null before the first Publish)
+	FSnapshotPtr Acquire() const
+	{
+		FReadScopeLock Lock(CurrentLock);
+		return Current;
 	}
 
-	TMap<FName, FName> BoneNameMap;   // copied from asset on CreateWorker
-	TMap<FName, FName> CurveNameMap;  // copied from asset on CreateWorker
+	// Curve program for the static data frames are remapped with (binds or compiles on a new instance)
+	FProgramPtr GetCurveProgram(const FVMCRemapperSnapshot& S, const TArray<FName>& Names);
+
+	// Writers: publishes Next unless the snapshot moved on since Base was read (bExact: any
+	// change; else only a new config) and Next is stale
+	void Swap(FSnapshotPtr Next, const FVMCRemapperSnapshot* Base, bool bExact);
+
+	FSnapshotPtr Current;
+	mutable FRWLock CurrentLock;        // guards Current itself: readers copy it, writers replace it
+	FCriticalSection WriterLock;        // serializes writers; remapping never takes it
 };
 
 // ---------------- Asset ----------------
@@ -211,10 +223,18 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Normalizer", meta = (ClampMin = "0.0", ClampMax = "1.0"))
 	float BlinkMirrorStrength = 1.0f;
 
+	// Declarative curve shaping, applied after the normalizer (post-remap curve names)
+	UPROPERTY(EditAnywhere, Category = "Curve Rules")
+	TArray<FVMCCurveRule> CurveRules;
+
+	// The MetaHuman normalizer expressed as curve rules (the worker runs them ahead of CurveRules)
+	static void AppendNormalizerRules(float JoyToSmileStrength, float BlinkMirrorStrength, TArray<FVMCCurveRule>& Out);
+
 private:
 	// Helpers
 	void RequestStaticDataRefresh();   // flips bDirty
 	void SyncWorker() const;
+	TSharedPtr<const FVMCRemapperConfig, ESPMode::ThreadSafe> BuildWorkerConfig() const;   // maps + normalizer rules + CurveRules
 
 	void SeedFromReferenceSkeleton();
 	void SeedCurves_ARKit();
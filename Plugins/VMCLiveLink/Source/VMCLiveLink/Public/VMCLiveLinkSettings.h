@@ -21,4 +21,12 @@ public:
     // Optional convenience: a project-wide default ref mesh
     UPROPERTY(EditAnywhere, Config, Category = "Defaults")
     TSoftObjectPtr<USkeletalMesh> DefaultReferenceSkeleton;
+
+    // Defaults are applied once, when a subject is created: changes (these setters, config
+    // reloads, edits) affect new subjects only. Existing ones keep the remapper they were given.
+    UFUNCTION(BlueprintCallable, Category = "VMC Live Link")
+    static void SetDefaultRemapperClass(TSoftClassPtr<ULiveLinkSubjectRemapper> InClass);
+
+    UFUNCTION(BlueprintCallable, Category = "VMC Live Link")
+    static void SetDefaultReferenceSkeleton(TSoftObjectPtr<USkeletalMesh> InMesh);
 };
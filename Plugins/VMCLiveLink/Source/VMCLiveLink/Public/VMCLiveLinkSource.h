@@ -4,16 +4,25 @@
 #include "CoreMinimal.h"
 #include "ILiveLinkSource.h"
 #include "HAL/CriticalSection.h"
-#include "UObject/StrongObjectPtr.h"
+#include "Containers/Ticker.h"
+#include "VMCLiveLinkSourceOptions.h"
+#include "VMCLiveLinkSourceStats.h"
+#include <atomic>
 
 // Forward declarations (keep OSC headers out of Public/)
-class UOSCServer;
-struct FOSCMessage;
+struct FVMCOscMessage;
+struct FVMCDecodedPacket;
+class FVMCPlayoutThread;
+struct FVMCPerformer;
+struct FVMCDeviceSubject;
+struct FVMCFrameSnapshot;
+struct FVMCStaticLayout;
 // forward declare to avoid pulling headers into the .h
 
 class ULiveLinkSubjectRemapper;
 class ULiveLinkSubjectSettings;
 class UVMCLiveLinkRemapper;
+class UVMCLiveLinkSourceSettings;
 
 /**
  * VMC → Live Link source (UE 5.6)
@@ -28,50 +37,86 @@ public:
     FVMCLiveLinkSource(const FString& InSourceName, int32 InPort);
     FVMCLiveLinkSource(const FString& InSourceName, int32 InPort, bool bInUnityToUE, bool bInMetersToCm, float InYawDeg);
     FVMCLiveLinkSource(const FString& InSourceName, int32 InPort, bool bInUnityToUE, bool bInMetersToCm, float InYawDeg, FString Subject);
+    FVMCLiveLinkSource(const FString& InSourceName, int32 InPort, bool bInUnityToUE, bool bInMetersToCm, float InYawDeg, FString Subject, const FVMCLiveLinkSourceOptions& InOptions);
+    virtual ~FVMCLiveLinkSource() override;
 
     // ILiveLinkSource
     virtual void ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid) override;
+    virtual void InitializeSettings(ULiveLinkSourceSettings* Settings) override;
+    virtual TSubclassOf<ULiveLinkSourceSettings> GetSettingsClass() const override;
+    virtual void Update() override;   // game thread: refreshes the statistics shown in the Live Link panel
     virtual bool IsSourceStillValid() const override { return bIsValid; }
     virtual bool RequestSourceShutdown() override;
 
     virtual FText GetSourceType() const override { return NSLOCTEXT("VMCLiveLink", "SourceType", "VMC (OSC)"); }
     virtual FText GetSourceMachineName() const override { return FText::FromString(TEXT("Local/Network")); }
     virtual FText GetSourceStatus() const override;
+
+    // Cumulative counters over all performers, and per subject (any thread)
+    void GetStats(FVMCLiveLinkSourceStats& Out) const;
+    void GetSubjectStats(TArray<FVMCLiveLinkSubjectStats>& Out) const;
     // Optional: point this to the same remapper asset you use in Subject Settings (or a duplicate)
     UPROPERTY(EditAnywhere, Category = "Remap")
     TSoftObjectPtr<UVMCLiveLinkRemapper> StaticNameRemapper;
 
 private:
-    // OSC lifecycle
-    bool StartOSC();
-    void StopOSC();
-    void OnOscMessageReceived(const FOSCMessage& Message, const FString& IPAddress, uint16 Port);
+    // Receive lifecycle: a listener on the port's shared receiver (FVMCReceiverRegistry)
+    bool StartReceiver();
+    void StopReceiver();
+    void OnPacketReceived(const FVMCDecodedPacket& Packet); // port's ingest thread
+
+    // Optional playout stage (JitterTargetMs > 0): one thread pushes for every performer
+    bool StartPlayout();
+    void StopPlayout();
+
+    // Output decimation (no jitter buffer): which commits get pushed
+    bool ShouldPushOnCommit(FVMCPerformer& P);   // ingest thread (PassThrough / FixedRate)
+    bool OnEngineTick(float DeltaTime);           // game thread (PerEngineTick and/or concealment)
+    void StopOutput();                            // removes the tick
+    void LogOutputStats() const;                  // committed / pushed / coalesced per performer
+
+    // Packet-loss concealment (ConcealMaxMs > 0)
+    void ConcealGap(FVMCPerformer& P, double Now);  // game thread: extrapolated frame while no data arrives
+    void LogConcealStats() const;                   // gaps / lost / concealed per performer
+
+    // Demultiplexing: sender → performer (subject). nullptr when the sender is not accepted.
+    FVMCPerformer* FindOrAddPerformer(uint32 FromIp, uint16 FromPort);
+    uint64 MakeSenderKey(uint32 FromIp, uint16 FromPort) const;
+    FName MakePerformerSubjectName(uint32 FromIp, uint16 FromPort) const;
+
+    // Shared VMC handling for both ingest paths
+    void HandleOscMessage(FVMCPerformer& P, const FVMCOscMessage& Msg);
+    void HandleBonePos(FVMCPerformer& P, FUtf8StringView Bone, const float* V);  // V = px,py,pz,qx,qy,qz,qw
+    void HandleRootPos(FVMCPerformer& P, const float* V);
+    void HandleBlendVal(FVMCPerformer& P, FUtf8StringView Curve, float Value);
+    void HandleBlendApply(FVMCPerformer& P);
+    void HandleDevicePos(FVMCPerformer& P, uint8 Kind, FUtf8StringView Serial, const float* V); // trackers / HMD / controllers
+    void HandleCamera(FVMCPerformer& P, FUtf8StringView Name, const float* V, float Fov);
+    void HandleStatus(FVMCPerformer& P, const FVMCOscMessage& Msg);
+    void HandleBundleEnd(FVMCPerformer& P);    // EVMCFrameCommit::OnBundle
+    void ApplyFrame(FVMCPerformer& P);         // commit pending samples + push (Apply or bundle end)
+
+    // Frame commit (ingest thread) → push step (reader of the performer's hand-off)
+    void CommitFrame(FVMCPerformer& P);       // snapshot pending samples and publish
+    void PushLatestFrame(FVMCPerformer& P);   // push the newest published snapshot, if any
+    void RebuildLayout(FVMCPerformer& P);     // new immutable static layout from current names/maps
 
     // Live Link pushes
-    void PushStaticData(bool bForce = false); // bones + property names
-    void PushFrame();                         // bone transforms + property values
-
-    // Cached copies of the asset’s maps (so we don’t re-hash every frame)
-    TMap<FName, FName> CachedBoneMap;
-    TMap<FName, FName> CachedCurveMap;
-    uint32 CachedMapsHash = 0;
-
-    // Cached local ref-pose offsets from the remapper’s ReferenceSkeleton
-    TMap<FName, FVector> RefLocalTranslationByName;
-    bool bHaveRefOffsets = false;
+    void PushStaticData(FVMCPerformer& P, const FVMCStaticLayout& Layout); // bones + property names
+    bool PushFrame(FVMCPerformer& P, const FVMCFrameSnapshot& Snapshot);   // bone transforms + property values; false = not sent (deadband)
 
     // Controls
     bool bUseRefOffsets = true;              // ← use ref-pose translations for non-root bones
     bool bPreferIncomingTranslations = false;// ← set true if your stream sends correct local translations
 
-    // One-shot flag to force static re-publish next Apply when maps change
-    bool bForceStaticNext = false;
-
     // Helpers
-    void RefreshStaticMapsIfNeeded();
-    void RefreshStaticMapsFromSettings(); // (we’ll extend this to also pull the ReferenceSkeleton)
+    void DeclareHumanoidSkeleton(FVMCPerformer& P);     // VMCHumanoidSchema → bone arrays (new performer)
+    void RequestRemapRefresh(FVMCPerformer& P);           // ingest thread: queue one game-thread rebuild
+    void AdoptRemapState(FVMCPerformer& P);               // ingest thread: take a published rebuild, if any
+    void RefreshStaticMapsFromSettings(FVMCPerformer& P); // game thread: remapper maps + ReferenceSkeleton → FVMCRemapState
+    void CheckSubjectRemappers();                         // game thread: refresh performers whose subject got another remapper
     static uint32 HashMaps(const TMap<FName, FName>& A, const TMap<FName, FName>& B);
-    void BuildRefOffsetsFromMesh(class USkeletalMesh* Mesh);
+    void BuildRefOffsetsFromMesh(FVMCPerformer& P, class USkeletalMesh* Mesh);
 
 private:
     // Identity / config
@@ -81,45 +126,50 @@ private:
     bool  bUnityToUE = true;   // enable basis conversion
     bool  bMetersToCm = true;   // scale positions 1m→100cm
     float YawOffsetDeg = 0.f;    // extra yaw about UE Z (re-express frame; no visible spin)
+
+    FVMCLiveLinkSourceOptions Options;
  
     // Live Link client
     ILiveLinkClient* Client = nullptr;
     FGuid  SourceGuid;
     bool   bIsValid = false;
 
-    // OSC server (UObject) – strong ref so it isn't GC'd
-    TStrongObjectPtr<UOSCServer> OscServer;
+    // Listener handle on the shared port receiver (0 = not listening)
+    uint64 ReceiverHandle = 0;
 
-    // Subject
-    FName SubjectName = FName(TEXT("VMC_Subject"));
+    // Ingest counters (written by the port's ingest thread)
+    std::atomic<uint64> DatagramsHandled{ 0 };
+    std::atomic<uint64> MessagesHandled{ 0 };
+    std::atomic<uint64> IngestCycles{ 0 };
+    std::atomic<uint64> MalformedDatagrams{ 0 };
+    std::atomic<uint64> RejectedDatagrams{ 0 };
 
-    // Shared state
-    mutable FCriticalSection DataGuard;
+    // Live Link panel statistics (game thread): settings object and the previous read for rates
+    TWeakObjectPtr<UVMCLiveLinkSourceSettings> StatsSettings;
+    double LastStatsSeconds = 0.0;
+    FVMCLiveLinkSourceStats LastSourceStats;
+    TMap<FName, FVMCLiveLinkSourceStats> LastSubjectStats;
+    float PacketsPerSecond = 0.f;          // GetSourceStatus
 
-    // Static (skeleton) tracking
-    bool bStaticSent = false;
-    int32 LastRemapVersion = -1;
+    // Playout thread (jitter buffer only)
+    TUniquePtr<FVMCPlayoutThread> PlayoutThread;
 
-    // Bones
-    TArray<FName> BoneNames;    // index-aligned
-    TArray<int32> BoneParents;  // -1 for root
+    // Game-thread tick: EVMCOutputPolicy::PerEngineTick pusher and concealment
+    FTSTicker::FDelegateHandle OutputTickHandle;
+
+    // Subject (base name; demultiplexed performers get a per-sender suffix or a rule's name)
+    FName SubjectName = FName(TEXT("VMC_Subject"));
 
-    // Per-frame pose cache
-    TMap<FName, FTransform> PendingPose; // bone -> transform
-    FTransform PendingRoot = FTransform::Identity;
+    // Threading: performers are created and fed by the port's ingest thread (OSC dispatch or
+    // native receiver). The lock only guards the array against readers on other threads (status).
+    TArray<TUniquePtr<FVMCPerformer>> Performers;
+    mutable FCriticalSection PerformersLock;
+    int32 LastPerformer = INDEX_NONE;        // ingest thread: last demux hit
 
-    // Curves → Properties (UE 5.6)
-    TArray<FName>     CurveNamesOrdered;     // advertised in StaticData.PropertyNames
-    TMap<FName, int32> CurveNameToIndex;      // name → index in CurveNamesOrdered
-    TMap<FName, float> PendingCurves;         // per-frame values
-    bool              bStaticCurvesDirty = false; // republish static when set grows
-   
-    // Track which remapper is currently bound (from subject settings)
-    TWeakObjectPtr<ULiveLinkSubjectRemapper> LastSeenRemapper;
-    TWeakObjectPtr<USkeletalMesh> LastRefMeshBuiltFrom; // NEW
+    FVMCDeviceSubject& FindOrAddDeviceSubject(FVMCPerformer& P, uint8 Kind, FUtf8StringView Serial);
+    FTransform ToUEWorldTransform(const float* V) const; // basis + units + yaw offset
 
     private:
-        void EnsureSubjectSettingsWithDefaults(); // create settings + attach default remapper/skeleton
-        bool bEnsuredDefaults = false;            // NEW: track we've done it once
+        void EnsureSubjectSettingsWithDefaults(FVMCPerformer& P); // create settings + attach default remapper/skeleton
 
 };
@@ -0,0 +1,120 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+// How datagrams get from the wire into FVMCLiveLinkSource
+enum class EVMCIngestMode : uint8
+{
+    OSCServer,  // UOSCServer + FOSCMessage (engine OSC plugin)
+    NativeUdp,  // own socket thread + in-place OSC decoding (no per-message allocations)
+    Replay      // datagrams from a capture file (ReplayPath) through the native decode path
+};
+
+// When pending samples become a Live Link frame
+enum class EVMCFrameCommit : uint8
+{
+    OnApply,    // /VMC/Ext/Blend/Apply (VMC spec)
+    OnBundle    // end of each OSC bundle that carried samples; Apply still commits bare messages
+};
+
+// When committed frames are handed to Live Link (without a jitter buffer)
+enum class EVMCOutputPolicy : uint8
+{
+    PassThrough,   // every commit is pushed
+    FixedRate,     // at most OutputRateHz pushes; commits in between are coalesced into the next one
+    PerEngineTick  // the newest commit is pushed once per engine tick (game thread)
+};
+
+// How datagrams on one port are split into Live Link subjects (performers)
+enum class EVMCDemuxMode : uint8
+{
+    None,            // every sender feeds the source's one subject
+    SenderEndpoint,  // one subject per sender IP:port
+    SenderAddress    // one subject per sender IP (survives sender port changes)
+};
+
+// IPv4 multicast reception: every host that joins the group gets the sender's one packet
+struct FVMCMulticastOptions
+{
+    FString Group;                          // e.g. 239.0.0.1; empty = unicast
+    FString Interface = TEXT("0.0.0.0");    // local interface address to join on (0.0.0.0 = OS default)
+};
+
+// Fixed subject name for a sender (demux modes only)
+struct FVMCPerformerRule
+{
+    FString Address;         // IPv4 of the sender
+    int32 Port = 0;          // 0 = any port
+    FName SubjectName;
+};
+
+/**
+ * Advanced per-source options (parsed from the connection string by the factory).
+ * Basic settings (port, subject, unity→ue, meters→cm, yaw) stay on the source constructor.
+ */
+struct VMCLIVELINK_API FVMCLiveLinkSourceOptions
+{
+    EVMCIngestMode IngestMode = EVMCIngestMode::OSCServer;
+
+    // Address the native receiver binds to (NativeUdp only)
+    FString BindAddress = TEXT("0.0.0.0");
+
+    // Capture / replay of raw datagrams (VMCCapture.h format; relative paths go under Saved/).
+    // Recording needs the native path (NativeUdp or Replay): the OSC plugin never exposes the bytes.
+    // A replay source has no socket; its port only names the channel listeners share.
+    FString RecordPath;
+    FString ReplayPath;
+    bool bReplayRealtime = true;   // original arrival timing; false = as fast as possible
+    bool bReplayLoop = false;
+
+    // Join a multicast group instead of plain unicast (NativeUdp; the OSC plugin server only
+    // takes the group). The socket then binds 0.0.0.0 and Interface picks the NIC. The socket
+    // only receives, so there are no send-side options (TTL, loopback).
+    FVMCMulticastOptions Multicast;
+
+    EVMCFrameCommit CommitMode = EVMCFrameCommit::OnApply;
+
+    // Pre-declare Unity's humanoid skeleton (root + HumanBodyBones with their real parents) when a
+    // subject is created, so static data goes out once with the right hierarchy. Bones outside the
+    // schema are appended under root; Hips then takes its translation from the stream.
+    // Off (default, as before) = build the skeleton from the stream as bones arrive.
+    bool bHumanoidSkeleton = false;
+
+    // Stamp frames with the bundle timetag (WorldTime mapped onto the local clock, SceneTime as
+    // sender time of day) instead of arrival time. Only the native path sees timetags. Off by
+    // default: a sender with a bad clock would skew frame times.
+    bool bUseSenderTime = false;
+
+    // Jitter buffer: frames are held for a playout delay and pushed on their own thread.
+    // 0 = off (push on commit). The delay starts at the target and, when adaptive, grows
+    // with measured arrival jitter up to JitterMaxMs.
+    float JitterTargetMs = 0.f;
+    float JitterMaxMs = 50.f;
+    bool bJitterAdaptive = true;
+
+    // Output decimation for senders faster than the consumer. Ingest still decodes and commits
+    // every frame; only the Live Link push is thinned. Ignored when the jitter buffer is on.
+    EVMCOutputPolicy OutputPolicy = EVMCOutputPolicy::PassThrough;
+    float OutputRateHz = 60.f;            // FixedRate only
+
+    // Packet-loss concealment: when frames stop for longer than ~1.5 sender intervals, keep the
+    // pose moving with each bone's recent angular/linear velocity for up to ConcealMaxMs (then
+    // hold), and blend back over ConcealBlendMs when data resumes. 0 = off (the last frame holds).
+    float ConcealMaxMs = 0.f;
+    float ConcealBlendMs = 150.f;
+
+    // Idle deadband: a frame whose bones and curves all stay within these epsilons of the last
+    // pushed frame is not sent, except once per heartbeat so subjects don't go stale
+    bool bDeadband = false;
+    float DeadbandRotationDeg = 0.05f;
+    float DeadbandTranslationCm = 0.01f;
+    float DeadbandCurve = 0.001f;
+    float DeadbandHeartbeatMs = 250.f;
+
+    // Performers: senders not matched by a rule get "<Subject>_<ip>[_<port>]"
+    EVMCDemuxMode DemuxMode = EVMCDemuxMode::None;
+    TArray<FVMCPerformerRule> PerformerRules;
+    bool bOnlyListedPerformers = false;   // ignore senders without a rule
+    int32 MaxPerformers = 16;             // new senders beyond this are ignored
+};
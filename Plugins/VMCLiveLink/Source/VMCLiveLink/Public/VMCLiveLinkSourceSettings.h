@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+#include "LiveLinkSourceSettings.h"
+#include "VMCLiveLinkSourceSettings.generated.h"
+
+// Read-only counters shown in the Live Link panel (rates over the last refresh, about once a second)
+USTRUCT()
+struct FVMCLiveLinkStatsView
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats")
+    FName Subject;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats", meta = (DisplayName = "Packets / s"))
+    float PacketsPerSecond = 0.f;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats", meta = (DisplayName = "Frames pushed / s"))
+    float FramesPerSecond = 0.f;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats", meta = (DisplayName = "Messages / frame"))
+    float MessagesPerFrame = 0.f;
+
+    // Commit (Apply / bundle end) → Live Link push over the last refresh, ms
+    UPROPERTY(VisibleAnywhere, Category = "Stats", meta = (DisplayName = "Apply → push p50 (ms)"))
+    float ApplyToPushP50Ms = 0.f;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats", meta = (DisplayName = "Apply → push p99 (ms)"))
+    float ApplyToPushP99Ms = 0.f;
+
+    // Totals since the source started
+    UPROPERTY(VisibleAnywhere, Category = "Stats")
+    int64 MalformedDatagrams = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats")
+    int64 BadMessages = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats")
+    int64 UnknownAddresses = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats", meta = (DisplayName = "Rejected senders (datagrams)"))
+    int64 RejectedDatagrams = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats")
+    int64 DroppedFrames = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats")
+    int64 CoalescedFrames = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats")
+    int64 SuppressedFrames = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stats")
+    int64 StaticRepublishes = 0;
+};
+
+/**
+ * Source settings of a VMC source: the stock Live Link source settings plus live ingest
+ * statistics (whole source and per subject), refreshed by the source on the game thread.
+ */
+UCLASS()
+class VMCLIVELINK_API UVMCLiveLinkSourceSettings : public ULiveLinkSourceSettings
+{
+    GENERATED_BODY()
+public:
+    UPROPERTY(VisibleAnywhere, Transient, Category = "Statistics")
+    FVMCLiveLinkStatsView Source;
+
+    UPROPERTY(VisibleAnywhere, Transient, Category = "Statistics")
+    TArray<FVMCLiveLinkStatsView> Subjects;
+};
@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Counters of one VMC source, summed over its performers (FVMCLiveLinkSource::GetStats), or of
+ * one subject (FVMCLiveLinkSource::GetSubjectStats). Values are cumulative since the source
+ * started; diff two reads for a window.
+ */
+struct VMCLIVELINK_API FVMCLiveLinkSourceStats
+{
+    // Latency histograms: bucket 0 is < 32 µs, bucket i < 32·2^i µs, the last one open-ended
+    static constexpr int32 NumLatencyBuckets = 16;
+    static int32 LatencyBucket(double Microseconds);
+    static double LatencyBucketUpperUs(int32 Bucket);
+
+    int32 NumPerformers = 0;
+
+    uint64 Datagrams = 0;      // packets handed to the source (after decode)
+    uint64 Messages = 0;       // OSC messages in them
+    uint64 Malformed = 0;      // datagrams (or OSC plugin messages) that failed to decode; source only
+    uint64 Rejected = 0;       // datagrams from senders the demux rules do not accept; source only
+    uint64 BadMessages = 0;    // known address with arguments of the wrong count or type
+    uint64 UnknownAddresses = 0; // messages whose address is not part of VMC
+    uint64 Committed = 0;      // frames committed
+    uint64 Pushed = 0;         // frames handed to Live Link
+    uint64 Coalesced = 0;      // replaced before they were pushed
+    uint64 Suppressed = 0;     // inside the idle deadband
+    uint64 Dropped = 0;        // jitter ring full at commit
+    uint64 StaticPushes = 0;   // static data (re)published to Live Link
+
+    double IngestSeconds = 0.0;  // time on the ingest thread: messages, commits and any pushes made there; source only
+    double PushSeconds = 0.0;    // time building and pushing frames, whichever thread pushed
+
+    // First sample of a frame handled → frame handed to Live Link
+    uint64 Latency[NumLatencyBuckets] = {};
+    // Frame committed (Apply / bundle end) → frame handed to Live Link
+    uint64 ApplyLatency[NumLatencyBuckets] = {};
+
+    // Upper bound (µs) of the bucket holding the given percentile (0..1); 0 without samples
+    double LatencyPercentileUs(double Percentile) const;
+    double ApplyLatencyPercentileUs(double Percentile) const;
+
+    FVMCLiveLinkSourceStats operator-(const FVMCLiveLinkSourceStats& Earlier) const;
+};
+
+// One subject's counters (FVMCLiveLinkSource::GetSubjectStats)
+struct FVMCLiveLinkSubjectStats
+{
+    FName Subject;
+    FVMCLiveLinkSourceStats Stats;
+};
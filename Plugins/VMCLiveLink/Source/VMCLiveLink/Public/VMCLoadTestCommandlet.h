@@ -0,0 +1,27 @@
+// Copyright (c) 2025 Lifelike & Believable Animation Design, Inc. | Athomas Goldberg. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "VMCLoadTestCommandlet.generated.h"
+
+/**
+ * Headless VMC ingest benchmark. Synthesizes N performers × M bones × K blendshapes at a fixed
+ * rate over loopback UDP into a FVMCLiveLinkSource registered with the Live Link client, then
+ * reports messages/sec, allocations and CPU time per frame and the ingest→push latency
+ * distribution for the measured window (after warm-up).
+ *
+ *   UnrealEditor-Cmd <Project> -run=VMCLoadTest [-performers=4] [-bones=55] [-blendshapes=52]
+ *       [-rate=60] [-seconds=10] [-warmup=2] [-port=39600] [-ingest=native|osc] [-commit=apply|bundle]
+ *       [-output=pass|rate|tick] [-outputhz=60] [-jitter=<ms>] [-deadband]
+ */
+UCLASS()
+class UVMCLoadTestCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UVMCLoadTestCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -29,7 +29,11 @@ public class VMCLiveLink : ModuleRules
         PrivateDependencyModuleNames.AddRange(new[]
         {
 			// used by AutoDetectAndApplyMapping()
-			"AssetRegistry"
+			"AssetRegistry",
+
+			// native UDP ingest (FVMCUdpReceiver)
+			"Sockets",
+			"Networking"
         });
 
         // Keep editor-only modules guarded so runtime packaging doesn't pull them in